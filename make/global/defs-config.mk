@@ -92,6 +92,8 @@ F_CONFIG_TRAIT_CONSOLE_TOGGLE ?= F_BUTTON_A,F_BUTTON_B,F_BUTTON_X,F_BUTTON_Y,F_B
 # Libraries
 #
 F_CONFIG_LIB_PNG ?= 0
+F_CONFIG_LIB_PTHREAD ?= 0
+F_CONFIG_LIB_PTHREAD_WORKERS ?= 0
 F_CONFIG_LIB_SDL ?= 0
 F_CONFIG_LIB_SDL_CONFIG ?=
 F_CONFIG_LIB_SDL_CURSOR ?= 1
@@ -122,6 +124,7 @@ F_CONFIG_DEBUG_MEM_POOL ?= 0
 F_CONFIG_ECS := 0
 F_CONFIG_ECS_COM ?=
 F_CONFIG_ECS_COM_NUM := $(words $(F_CONFIG_ECS_COM))
+F_CONFIG_ECS_STORAGE ?= F_ECS_STORAGE_POOL
 F_CONFIG_ECS_SYS ?=
 F_CONFIG_ECS_SYS_NUM := $(words $(F_CONFIG_ECS_SYS))
 
@@ -140,6 +143,15 @@ F_CONFIG_FILES_EMBED_C ?= 0
 F_CONFIG_FILES_EMBED_EXTS ?= .txt .png .wav
 F_CONFIG_FILES_STORAGE_PREFIX ?=
 
+#
+# Fonts
+#
+ifeq ($(F_CONFIG_TRAIT_LOW_MEM), 1)
+    F_CONFIG_FONT_CACHE ?= 0
+endif
+
+F_CONFIG_FONT_CACHE ?= 32
+
 #
 # FPS
 #
@@ -183,10 +195,13 @@ else ifeq ($(F_CONFIG_LIB_SDL), 2)
     F_CONFIG_SCREEN_VSYNC ?= 1
 endif
 
+F_CONFIG_SCREEN_ATLAS ?= 0
 F_CONFIG_SCREEN_FORMAT ?= F_COLOR_FORMAT_RGB_565
 F_CONFIG_SCREEN_FULLSCREEN ?= 0
 F_CONFIG_SCREEN_MAXIMIZED ?= 1
 F_CONFIG_SCREEN_RENDER ?= F_SCREEN_RENDER_SOFTWARE
+F_CONFIG_SCREEN_RENDER_QUEUE ?= 0
+F_CONFIG_SCREEN_RENDER_THREADS ?= 0
 F_CONFIG_SCREEN_SIZE_HEIGHT ?= 240
 F_CONFIG_SCREEN_SIZE_HEIGHT_HW ?= 0
 F_CONFIG_SCREEN_SIZE_WIDTH ?= 320
@@ -240,15 +255,19 @@ F_CONFIG_BUILD_FLAGS_SETTINGS := \
     -DF_CONFIG_DIR_SCREENSHOTS=\"$(F_CONFIG_DIR_SCREENSHOTS)\" \
     -DF_CONFIG_ECS=$(F_CONFIG_ECS) \
     -DF_CONFIG_ECS_COM_NUM=$(F_CONFIG_ECS_COM_NUM) \
+    -DF_CONFIG_ECS_STORAGE=$(F_CONFIG_ECS_STORAGE) \
     -DF_CONFIG_ECS_SYS_NUM=$(F_CONFIG_ECS_SYS_NUM) \
     -DF_CONFIG_FILES_EMBED_BLOB=$(F_CONFIG_FILES_EMBED_BLOB) \
     -DF_CONFIG_FILES_EMBED_BLOB_FILE=\"$(F_CONFIG_FILES_EMBED_BLOB_FILE)\" \
     -DF_CONFIG_FILES_EMBED_C=$(F_CONFIG_FILES_EMBED_C) \
     -DF_CONFIG_FILES_STORAGE_PREFIX=\"$(F_CONFIG_FILES_STORAGE_PREFIX)\" \
+    -DF_CONFIG_FONT_CACHE=$(F_CONFIG_FONT_CACHE) \
     -DF_CONFIG_FPS_CAP=$(F_CONFIG_FPS_CAP) \
     -DF_CONFIG_FPS_RATE_DRAW=$(F_CONFIG_FPS_RATE_DRAW) \
     -DF_CONFIG_FPS_RATE_TICK=$(F_CONFIG_FPS_RATE_TICK) \
     -DF_CONFIG_LIB_PNG=$(F_CONFIG_LIB_PNG) \
+    -DF_CONFIG_LIB_PTHREAD=$(F_CONFIG_LIB_PTHREAD) \
+    -DF_CONFIG_LIB_PTHREAD_WORKERS=$(F_CONFIG_LIB_PTHREAD_WORKERS) \
     -DF_CONFIG_LIB_SDL=$(F_CONFIG_LIB_SDL) \
     -DF_CONFIG_LIB_SDL_CURSOR=$(F_CONFIG_LIB_SDL_CURSOR) \
     -DF_CONFIG_LIB_SDL_GAMEPADMAP=\"$(F_CONFIG_LIB_SDL_GAMEPADMAP)\" \
@@ -264,6 +283,8 @@ F_CONFIG_BUILD_FLAGS_SETTINGS := \
     -DF_CONFIG_SCREEN_FULLSCREEN=$(F_CONFIG_SCREEN_FULLSCREEN) \
     -DF_CONFIG_SCREEN_MAXIMIZED=$(F_CONFIG_SCREEN_MAXIMIZED) \
     -DF_CONFIG_SCREEN_RENDER=$(F_CONFIG_SCREEN_RENDER) \
+    -DF_CONFIG_SCREEN_RENDER_QUEUE=$(F_CONFIG_SCREEN_RENDER_QUEUE) \
+    -DF_CONFIG_SCREEN_RENDER_THREADS=$(F_CONFIG_SCREEN_RENDER_THREADS) \
     -DF_CONFIG_SCREEN_SIZE_HEIGHT=$(F_CONFIG_SCREEN_SIZE_HEIGHT) \
     -DF_CONFIG_SCREEN_SIZE_HEIGHT_HW=$(F_CONFIG_SCREEN_SIZE_HEIGHT_HW) \
     -DF_CONFIG_SCREEN_SIZE_WIDTH=$(F_CONFIG_SCREEN_SIZE_WIDTH) \
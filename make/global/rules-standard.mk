@@ -65,6 +65,10 @@ ifdef F_CONFIG_LIB_SDL_CONFIG
     F_BUILD_FLAGS_SHARED_C_AND_CPP += $(shell $(F_CONFIG_LIB_SDL_CONFIG) --cflags)
 endif
 
+ifeq ($(F_CONFIG_LIB_PTHREAD), 1)
+    F_BUILD_FLAGS_SHARED_C_AND_CPP += -pthread
+endif
+
 F_BUILD_FLAGS_C := \
     $(F_BUILD_FLAGS_SHARED_C_AND_CPP) \
     $(F_CONFIG_BUILD_FLAGS_C) \
@@ -102,6 +106,10 @@ ifdef F_CONFIG_LIB_SDL_CONFIG
     F_BUILD_LIBS += $(shell $(F_CONFIG_LIB_SDL_CONFIG) --libs)
 endif
 
+ifeq ($(F_CONFIG_LIB_PTHREAD), 1)
+    F_BUILD_LIBS += -pthread
+endif
+
 #
 # Static files to copy to the build bin dir
 #
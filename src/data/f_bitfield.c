@@ -33,6 +33,15 @@ FBitfield* f_bitfield_new(unsigned NumBits)
     return b;
 }
 
+FBitfield* f_bitfield_dup(const FBitfield* Bitfield)
+{
+    F__CHECK(Bitfield != NULL);
+
+    return f_mem_dup(
+            Bitfield,
+            sizeof(FBitfield) + (Bitfield->numChunks - 1) * sizeof(FChunk));
+}
+
 void f_bitfield_free(FBitfield* Bitfield)
 {
     if(Bitfield == NULL) {
@@ -92,3 +101,42 @@ bool f_bitfield_testMask(const FBitfield* Bitfield, const FBitfield* Mask)
 
     return true;
 }
+
+bool f_bitfield_testAny(const FBitfield* Bitfield, const FBitfield* Mask)
+{
+    F__CHECK(Bitfield != NULL);
+    F__CHECK(Mask != NULL);
+    F__CHECK(Mask->numChunks <= Bitfield->numChunks);
+
+    for(unsigned i = Mask->numChunks; i--; ) {
+        if((Bitfield->chunks[i] & Mask->chunks[i]) != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool f_bitfield_testEqual(const FBitfield* A, const FBitfield* B)
+{
+    F__CHECK(A != NULL);
+    F__CHECK(B != NULL);
+    F__CHECK(A->numChunks == B->numChunks);
+
+    return memcmp(A->chunks, B->chunks, A->numChunks * sizeof(FChunk)) == 0;
+}
+
+unsigned f_bitfield_hash(const FBitfield* Bitfield)
+{
+    F__CHECK(Bitfield != NULL);
+
+    // FNV-1a over the chunks' bytes
+    const uint8_t* bytes = (const uint8_t*)Bitfield->chunks;
+    unsigned h = 2166136261u;
+
+    for(size_t n = Bitfield->numChunks * sizeof(FChunk); n--; ) {
+        h = (h ^ *bytes++) * 16777619u;
+    }
+
+    return h;
+}
@@ -23,6 +23,7 @@
 typedef struct FBitfield FBitfield;
 
 extern FBitfield* f_bitfield_new(unsigned NumBits);
+extern FBitfield* f_bitfield_dup(const FBitfield* Bitfield);
 extern void f_bitfield_free(FBitfield* Bitfield);
 
 extern void f_bitfield_set(FBitfield* Bitfield, unsigned Bit);
@@ -31,5 +32,9 @@ extern void f_bitfield_reset(FBitfield* Bitfield);
 
 extern bool f_bitfield_test(const FBitfield* Bitfield, unsigned Bit);
 extern bool f_bitfield_testMask(const FBitfield* Bitfield, const FBitfield* Mask);
+extern bool f_bitfield_testAny(const FBitfield* Bitfield, const FBitfield* Mask);
+extern bool f_bitfield_testEqual(const FBitfield* A, const FBitfield* B);
+
+extern unsigned f_bitfield_hash(const FBitfield* Bitfield);
 
 #endif // F_INC_DATA_BITFIELD_P_H
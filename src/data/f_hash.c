@@ -55,16 +55,15 @@ static const uint8_t g_crc8[256] = {
 };
 #endif // !F_CONFIG_BUILD_GEN_LUTS
 
+#define F__SLOTS_MIN 8
+#define F__SLOT_EMPTY 0
+#define F__SLOT_REMOVED UINT_MAX
+
 static bool keyEqual(const void* KeyA, const void* KeyB)
 {
     return KeyA == KeyB;
 }
 
-static inline unsigned getSlot(const FHash* Hash, const void* Key)
-{
-    return Hash->function(Key) & (Hash->numSlots - 1);
-}
-
 static unsigned func_djb2(const char* Key)
 {
     unsigned h = 5381;
@@ -76,6 +75,77 @@ static unsigned func_djb2(const char* Key)
     return h;
 }
 
+// Returns the slot that holds Key, or the empty slot that ends its probe
+static unsigned slotFind(const FHash* Hash, const void* Key, unsigned KeyHash)
+{
+    unsigned mask = Hash->numSlots - 1;
+
+    for(unsigned s = KeyHash & mask; ; s = (s + 1) & mask) {
+        unsigned index = Hash->slots[s];
+
+        if(index == F__SLOT_EMPTY) {
+            return s;
+        }
+
+        if(index != F__SLOT_REMOVED) {
+            const F__HashEntry* e = &Hash->entries[index - 1];
+
+            if(e->hash == KeyHash && Hash->keyEqual(Key, e->key)) {
+                return s;
+            }
+        }
+    }
+}
+
+static F__HashEntry* entryFind(const FHash* Hash, const void* Key)
+{
+    unsigned index = Hash->slots[slotFind(Hash, Key, Hash->function(Key))];
+
+    if(index == F__SLOT_EMPTY) {
+        return NULL;
+    }
+
+    return &Hash->entries[index - 1];
+}
+
+// Moves the live entries into new arrays, dropping removed ones
+static void tableResize(FHash* Hash, unsigned NumSlots)
+{
+    unsigned entriesCapacity = NumSlots / 4 * 3;
+    unsigned mask = NumSlots - 1;
+    unsigned numEntries = 0;
+
+    F__HashEntry* entries =
+        f_mem_malloc(entriesCapacity * sizeof(F__HashEntry));
+    unsigned* slots = f_mem_mallocz(NumSlots * sizeof(unsigned));
+
+    for(unsigned i = 0; i < Hash->numEntriesUsed; i++) {
+        const F__HashEntry* e = &Hash->entries[i];
+
+        if(e->key == NULL) {
+            continue;
+        }
+
+        unsigned s = e->hash & mask;
+
+        while(slots[s] != F__SLOT_EMPTY) {
+            s = (s + 1) & mask;
+        }
+
+        entries[numEntries] = *e;
+        slots[s] = ++numEntries;
+    }
+
+    f_mem_free(Hash->entries);
+    f_mem_free(Hash->slots);
+
+    Hash->numSlots = NumSlots;
+    Hash->entriesCapacity = entriesCapacity;
+    Hash->numEntriesUsed = numEntries;
+    Hash->entries = entries;
+    Hash->slots = slots;
+}
+
 FHash* f_hash_new(FCallHashFunction* Function, FCallHashEqual* KeyEqual, FCallFree* KeyFree, unsigned NumSlots)
 {
     F__CHECK(Function != NULL);
@@ -85,25 +155,19 @@ FHash* f_hash_new(FCallHashFunction* Function, FCallHashEqual* KeyEqual, FCallFr
         F__FATAL("f_hash_new: 0 slots");
     }
 
-    if((NumSlots & (NumSlots - 1)) != 0) {
-        unsigned slots = 1;
+    unsigned slots = F__SLOTS_MIN;
 
-        while(slots < NumSlots) {
-            slots <<= 1;
-        }
-
-        NumSlots = slots;
+    while(slots < NumSlots) {
+        slots <<= 1;
     }
 
-    FHash* h = f_mem_mallocz(
-                sizeof(FHash) + (NumSlots - 1) * sizeof(F__HashEntry*));
+    FHash* h = f_mem_mallocz(sizeof(FHash));
 
     h->function = Function;
     h->keyEqual = KeyEqual ? KeyEqual : keyEqual;
     h->keyFree = KeyFree;
-    h->numSlots = NumSlots;
 
-    f_listintr_init(&h->entries, F__HashEntry, listNode);
+    tableResize(h, slots);
 
     return h;
 }
@@ -133,7 +197,13 @@ void f_hash_freeEx(FHash* Hash, FCallFree* Free)
         return;
     }
 
-    F_LISTINTR_ITERATE(&Hash->entries, F__HashEntry*, e) {
+    for(unsigned i = 0; i < Hash->numEntriesUsed; i++) {
+        F__HashEntry* e = &Hash->entries[i];
+
+        if(e->key == NULL) {
+            continue;
+        }
+
         if(Free) {
             Free(e->content);
         }
@@ -141,10 +211,10 @@ void f_hash_freeEx(FHash* Hash, FCallFree* Free)
         if(Hash->keyFree) {
             Hash->keyFree((void*)e->key);
         }
-
-        f_pool_release(e);
     }
 
+    f_mem_free(Hash->entries);
+    f_mem_free(Hash->slots);
     f_mem_free(Hash);
 }
 
@@ -153,25 +223,39 @@ void f_hash_add(FHash* Hash, const void* Key, void* Content)
     F__CHECK(Hash != NULL);
     F__CHECK(Key != NULL);
 
-    unsigned slot = getSlot(Hash, Key);
+    unsigned hash = Hash->function(Key);
 
     #if F_CONFIG_DEBUG
-        for(F__HashEntry* e = Hash->slots[slot]; e; e = e->next) {
-            if(Hash->keyEqual(Key, e->key)) {
-                f_out__error("f_hash_add: Key already in table");
-            }
+        if(Hash->slots[slotFind(Hash, Key, hash)] != F__SLOT_EMPTY) {
+            f_out__error("f_hash_add: Key already in table");
         }
     #endif
 
-    F__HashEntry* oldEntry = Hash->slots[slot];
-    F__HashEntry* newEntry = f_pool__alloc(F_POOL__HASHENTRY);
+    if(Hash->numEntriesUsed == Hash->entriesCapacity) {
+        // Grow if the table is at least half live, otherwise just compact
+        if(Hash->numEntries >= Hash->entriesCapacity / 2) {
+            tableResize(Hash, Hash->numSlots * 2);
+        } else {
+            tableResize(Hash, Hash->numSlots);
+        }
+    }
+
+    unsigned mask = Hash->numSlots - 1;
+    unsigned s = hash & mask;
+
+    while(Hash->slots[s] != F__SLOT_EMPTY
+        && Hash->slots[s] != F__SLOT_REMOVED) {
+
+        s = (s + 1) & mask;
+    }
+
+    F__HashEntry* e = &Hash->entries[Hash->numEntriesUsed];
 
-    newEntry->next = oldEntry;
-    newEntry->key = Key;
-    newEntry->content = Content;
+    e->key = Key;
+    e->content = Content;
+    e->hash = hash;
 
-    Hash->slots[slot] = newEntry;
-    f_listintr_addLast(&Hash->entries, newEntry);
+    Hash->slots[s] = ++Hash->numEntriesUsed;
     Hash->numEntries++;
 }
 
@@ -181,36 +265,31 @@ void* f_hash_update(FHash* Hash, const void* Key, void* NewContent)
     F__CHECK(Key != NULL);
     F__CHECK(NewContent != NULL);
 
-    unsigned slot = getSlot(Hash, Key);
+    F__HashEntry* e = entryFind(Hash, Key);
 
-    for(F__HashEntry* e = Hash->slots[slot]; e; e = e->next) {
-        if(Hash->keyEqual(Key, e->key)) {
-            void* oldContent = e->content;
-            e->content = NewContent;
-
-            return oldContent;
-        }
+    if(e == NULL) {
+        return NULL;
     }
 
-    return NULL;
+    void* oldContent = e->content;
+    e->content = NewContent;
+
+    return oldContent;
 }
 
-static void removeEntry(FHash* Hash, unsigned Slot, F__HashEntry* Current, F__HashEntry* Previous)
+static void slotRemove(FHash* Hash, unsigned Slot)
 {
-    if(Previous == NULL) {
-        Hash->slots[Slot] = Current->next;
-    } else {
-        Previous->next = Current->next;
-    }
-
-    f_listintr_removeNode(&Current->listNode);
-    Hash->numEntries--;
+    F__HashEntry* e = &Hash->entries[Hash->slots[Slot] - 1];
 
     if(Hash->keyFree) {
-        Hash->keyFree((void*)Current->key);
+        Hash->keyFree((void*)e->key);
     }
 
-    f_pool_release(Current);
+    // The entry stays in the array until the next resize
+    e->key = NULL;
+
+    Hash->slots[Slot] = F__SLOT_REMOVED;
+    Hash->numEntries--;
 }
 
 void f_hash_removeKey(FHash* Hash, const void* Key)
@@ -218,15 +297,10 @@ void f_hash_removeKey(FHash* Hash, const void* Key)
     F__CHECK(Hash != NULL);
     F__CHECK(Key != NULL);
 
-    unsigned slot = getSlot(Hash, Key);
-    F__HashEntry* prev = NULL;
+    unsigned s = slotFind(Hash, Key, Hash->function(Key));
 
-    for(F__HashEntry* e = Hash->slots[slot]; e; prev = e, e = e->next) {
-        if(Hash->keyEqual(Key, e->key)) {
-            removeEntry(Hash, slot, e, prev);
-
-            return;
-        }
+    if(Hash->slots[s] != F__SLOT_EMPTY) {
+        slotRemove(Hash, s);
     }
 }
 
@@ -235,15 +309,20 @@ void f_hash_removeItem(FHash* Hash, const void* Content)
     F__CHECK(Hash != NULL);
     F__CHECK(Content != NULL);
 
-    for(unsigned slot = Hash->numSlots; slot--; ) {
-        F__HashEntry* prev = NULL;
+    for(unsigned i = 0; i < Hash->numEntriesUsed; i++) {
+        const F__HashEntry* e = &Hash->entries[i];
 
-        for(F__HashEntry* e = Hash->slots[slot]; e; prev = e, e = e->next) {
-            if(e->content == Content) {
-                removeEntry(Hash, slot, e, prev);
+        if(e->key != NULL && e->content == Content) {
+            unsigned mask = Hash->numSlots - 1;
+            unsigned s = e->hash & mask;
 
-                return;
+            while(Hash->slots[s] != i + 1) {
+                s = (s + 1) & mask;
             }
+
+            slotRemove(Hash, s);
+
+            return;
         }
     }
 }
@@ -253,15 +332,9 @@ void* f_hash_get(const FHash* Hash, const void* Key)
     F__CHECK(Hash != NULL);
     F__CHECK(Key != NULL);
 
-    unsigned slot = getSlot(Hash, Key);
-
-    for(F__HashEntry* e = Hash->slots[slot]; e; e = e->next) {
-        if(Hash->keyEqual(Key, e->key)) {
-            return e->content;
-        }
-    }
+    const F__HashEntry* e = entryFind(Hash, Key);
 
-    return NULL;
+    return e ? e->content : NULL;
 }
 
 bool f_hash_contains(const FHash* Hash, const void* Key)
@@ -269,87 +342,139 @@ bool f_hash_contains(const FHash* Hash, const void* Key)
     F__CHECK(Hash != NULL);
     F__CHECK(Key != NULL);
 
-    unsigned slot = getSlot(Hash, Key);
+    return entryFind(Hash, Key) != NULL;
+}
+
+unsigned f_hash_sizeGet(const FHash* Hash)
+{
+    F__CHECK(Hash != NULL);
+
+    return Hash->numEntries;
+}
+
+static void** arrayFill(const FHash* Hash, void** Array)
+{
+    unsigned index = 0;
 
-    for(F__HashEntry* e = Hash->slots[slot]; e; e = e->next) {
-        if(Hash->keyEqual(Key, e->key)) {
-            return true;
+    for(unsigned i = 0; i < Hash->numEntriesUsed; i++) {
+        if(Hash->entries[i].key != NULL) {
+            Array[index++] = Hash->entries[i].content;
         }
     }
 
-    return false;
+    return Array;
 }
 
-unsigned f_hash_sizeGet(const FHash* Hash)
+void** f_hash_toArray(const FHash* Hash)
 {
     F__CHECK(Hash != NULL);
+    F__CHECK(Hash->numEntries > 0);
 
-    return Hash->numEntries;
+    return arrayFill(Hash, f_mem_malloc(Hash->numEntries * sizeof(void*)));
 }
 
-void** f_hash_toArray(const FHash* Hash)
+void** f_hash_toArrayFrame(const FHash* Hash)
 {
     F__CHECK(Hash != NULL);
     F__CHECK(Hash->numEntries > 0);
 
-    void** array = f_mem_malloc(Hash->numEntries * sizeof(void*));
+    return arrayFill(
+            Hash, f_arena_frameAlloc(Hash->numEntries * sizeof(void*)));
+}
+
+F__HashIt f__hashit_new(const FHash* Hash)
+{
+    F__CHECK(Hash != NULL);
+
+    F__HashIt it;
+
+    it.hash = Hash;
+    it.next = 0;
+
+    return it;
+}
+
+static const F__HashEntry* itNext(F__HashIt* Iterator)
+{
+    const FHash* hash = Iterator->hash;
+
+    while(Iterator->next < hash->numEntriesUsed) {
+        const F__HashEntry* e = &hash->entries[Iterator->next++];
 
-    F_LISTINTR_ITERATE(&Hash->entries, const F__HashEntry*, e) {
-        array[F_LISTINTR_INDEX()] = e->content;
+        if(e->key != NULL) {
+            return e;
+        }
     }
 
-    return array;
+    return NULL;
 }
 
-const FListIntr* f__hash_entries(const FHash* Hash)
+bool f__hashit_getNext(F__HashIt* Iterator, void* UserPtrAddress)
 {
-    return &Hash->entries;
+    const F__HashEntry* e = itNext(Iterator);
+
+    if(e == NULL) {
+        return false;
+    }
+
+    *(void**)UserPtrAddress = e->content;
+
+    return true;
 }
 
-void* f__hash_entryValue(const F__HashEntry* Entry)
+bool f__hashit_getNextKey(F__HashIt* Iterator, void* UserPtrAddress)
 {
-    return Entry->content;
+    const F__HashEntry* e = itNext(Iterator);
+
+    if(e == NULL) {
+        return false;
+    }
+
+    *(const void**)UserPtrAddress = e->key;
+
+    return true;
 }
 
-const void* f__hash_entryKey(const F__HashEntry* Entry)
+const void* f__hashit_keyGet(const F__HashIt* Iterator)
 {
-    return Entry->key;
+    return Iterator->hash->entries[Iterator->next - 1].key;
 }
 
 void f__hash_printStats(const FHash* Hash, const char* Message)
 {
-    unsigned occupiedSlots = 0, slotsWithCollisions = 0, collisions = 0;
-    unsigned minLength = UINT_MAX, maxLength = 0, lengthSum = 0;
+    unsigned removedSlots = 0, collisions = 0;
+    unsigned probeSum = 0, probeMax = 0;
+    unsigned mask = Hash->numSlots - 1;
+
+    for(unsigned s = 0; s < Hash->numSlots; s++) {
+        unsigned index = Hash->slots[s];
 
-    for(unsigned slot = 0; slot < Hash->numSlots; slot++) {
-        unsigned entriesInSlot = 0;
+        if(index == F__SLOT_EMPTY) {
+            continue;
+        }
 
-        for(F__HashEntry* e = Hash->slots[slot]; e; e = e->next) {
-            entriesInSlot++;
+        if(index == F__SLOT_REMOVED) {
+            removedSlots++;
+            continue;
         }
 
-        if(entriesInSlot > 0) {
-            occupiedSlots++;
-            lengthSum += entriesInSlot;
+        // How far this entry landed from its home slot
+        unsigned probe = (s - Hash->entries[index - 1].hash) & mask;
 
-            if(entriesInSlot > 1) {
-                slotsWithCollisions++;
-                collisions += entriesInSlot - 1;
-            }
+        if(probe > 0) {
+            collisions++;
+        }
 
-            if(entriesInSlot < minLength) {
-                minLength = entriesInSlot;
-            }
+        probeSum += probe;
 
-            if(entriesInSlot > maxLength) {
-                maxLength = entriesInSlot;
-            }
+        if(probe > probeMax) {
+            probeMax = probe;
         }
     }
 
     printf("%s: ", Message);
 
-    if(occupiedSlots == 0) {
+    if(Hash->numEntries == 0) {
         printf("empty\n");
 
         return;
@@ -357,25 +482,22 @@ void f__hash_printStats(const FHash* Hash, const char* Message)
 
     printf(
         "%d/%d (%d%%) slots used, "
-        "%d/%d (%d%%) slots have collisions, "
+        "%d removed, "
         "%d/%d (%d%%) entries collide, "
-        "chain min=%d avg=%.2f max=%d\n",
+        "probe avg=%.2f max=%d\n",
 
-        occupiedSlots,
+        Hash->numEntries,
         Hash->numSlots,
-        100 * occupiedSlots / Hash->numSlots,
+        100 * Hash->numEntries / Hash->numSlots,
 
-        slotsWithCollisions,
-        Hash->numSlots,
-        100 * slotsWithCollisions / Hash->numSlots,
+        removedSlots,
 
         collisions,
         Hash->numEntries,
         100 * collisions / Hash->numEntries,
 
-        minLength,
-        (float)lengthSum / (float)occupiedSlots,
-        maxLength);
+        (float)probeSum / (float)Hash->numEntries,
+        probeMax);
 }
 
 uint8_t f_hash_crc8(const void* Buffer, size_t Size)
@@ -21,12 +21,14 @@
 #include "../general/f_system_includes.h"
 
 typedef struct FHash FHash;
-typedef struct F__HashEntry F__HashEntry;
 
 typedef unsigned FCallHashFunction(const void* Key);
 typedef bool FCallHashEqual(const void* KeyA, const void* KeyB);
 
-#include "../data/f_listintr.p.h"
+typedef struct {
+    const FHash* hash;
+    unsigned next;
+} F__HashIt;
 
 extern FHash* f_hash_new(FCallHashFunction* Function, FCallHashEqual* KeyEqual, FCallFree* KeyFree, unsigned NumSlots);
 extern FHash* f_hash_newStr(unsigned NumSlots, bool FreeKeyString);
@@ -44,22 +46,26 @@ extern bool f_hash_contains(const FHash* Hash, const void* Key);
 
 extern unsigned f_hash_sizeGet(const FHash* Hash);
 extern void** f_hash_toArray(const FHash* Hash);
+extern void** f_hash_toArrayFrame(const FHash* Hash);
 
-extern const FListIntr* f__hash_entries(const FHash* Hash);
-extern void* f__hash_entryValue(const F__HashEntry* Entry);
-extern const void* f__hash_entryKey(const F__HashEntry* Entry);
+extern F__HashIt f__hashit_new(const FHash* Hash);
+extern bool f__hashit_getNext(F__HashIt* Iterator, void* UserPtrAddress);
+extern bool f__hashit_getNextKey(F__HashIt* Iterator, void* UserPtrAddress);
+extern const void* f__hashit_keyGet(const F__HashIt* Iterator);
 
 #define F_HASH_ITERATE(Hash, PtrType, Name)                              \
-    F_LISTINTR_ITERATE(f__hash_entries(Hash), const F__HashEntry*, f__e) \
-        for(PtrType Name = f__hash_entryValue(f__e);                     \
-            f__e != NULL; f__e = NULL)
+    for(F__HashIt f__it = f__hashit_new(Hash);                           \
+        f__it.hash != NULL;                                              \
+        f__it.hash = NULL)                                               \
+        for(PtrType Name; f__hashit_getNext(&f__it, (void*)&Name); )
 
 #define F_HASH_ITERATE_KEYS(Hash, PtrType, Name)                         \
-    F_LISTINTR_ITERATE(f__hash_entries(Hash), const F__HashEntry*, f__e) \
-        for(PtrType Name = f__hash_entryKey(f__e);                       \
-            f__e != NULL; f__e = NULL)
+    for(F__HashIt f__it = f__hashit_new(Hash);                           \
+        f__it.hash != NULL;                                              \
+        f__it.hash = NULL)                                               \
+        for(PtrType Name; f__hashit_getNextKey(&f__it, (void*)&Name); )
 
-#define F_HASH_KEY() f__hash_entryKey(f__e)
+#define F_HASH_KEY() f__hashit_keyGet(&f__it)
 
 extern void f__hash_printStats(const FHash* Hash, const char* Message);
 
@@ -20,25 +20,28 @@
 
 #include "f_hash.p.h"
 
+typedef struct F__HashEntry F__HashEntry;
+
 #include "../general/f_init.v.h"
 
 extern const FPack f_pack__hash;
 
 struct F__HashEntry {
-    FListIntrNode listNode;
-    F__HashEntry* next;
-    const void* key;
+    const void* key; // NULL if the entry was removed
     void* content;
+    unsigned hash; // Full hash of key, checked before calling keyEqual
 };
 
 struct FHash {
     FCallHashFunction* function;
     FCallHashEqual* keyEqual;
     FCallFree* keyFree;
-    unsigned numSlots;
-    unsigned numEntries;
-    FListIntr entries; // FListIntr<F__HashEntry*>
-    F__HashEntry* slots[1]; // [numSlots]
+    unsigned numSlots; // Power of 2
+    unsigned numEntries; // Live entries
+    unsigned numEntriesUsed; // Live and removed entries at start of array
+    unsigned entriesCapacity; // 3/4 of numSlots
+    F__HashEntry* entries; // [entriesCapacity], in insertion order
+    unsigned* slots; // [numSlots], entries index + 1, or empty or removed
 };
 
 #endif // F_INC_DATA_HASH_V_H
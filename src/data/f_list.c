@@ -78,7 +78,7 @@ FListNode* f_list_addFirst(FList* List, void* Content)
     F__CHECK(List != NULL);
     F__CHECK(Content != NULL);
 
-    FListNode* n = f_pool__alloc(F_POOL__LISTNODE);
+    FListNode* n = f_pool__allocRaw(F_POOL__LISTNODE);
 
     n->content = Content;
     n->list = List;
@@ -98,7 +98,7 @@ FListNode* f_list_addLast(FList* List, void* Content)
     F__CHECK(List != NULL);
     F__CHECK(Content != NULL);
 
-    FListNode* n = f_pool__alloc(F_POOL__LISTNODE);
+    FListNode* n = f_pool__allocRaw(F_POOL__LISTNODE);
 
     n->content = Content;
     n->list = List;
@@ -349,19 +349,31 @@ FList* f_list_dup(const FList* List)
     return l;
 }
 
+static void** arrayFill(const FList* List, void** Array)
+{
+    int i = 0;
+
+    F__ITERATE(List, n) {
+        Array[i++] = n->content;
+    }
+
+    return Array;
+}
+
 void** f_list_toArray(const FList* List)
 {
     F__CHECK(List != NULL);
     F__CHECK(List->items > 0);
 
-    int i = 0;
-    void** array = f_mem_malloc(List->items * sizeof(void*));
+    return arrayFill(List, f_mem_malloc(List->items * sizeof(void*)));
+}
 
-    F__ITERATE(List, n) {
-        array[i++] = n->content;
-    }
+void** f_list_toArrayFrame(const FList* List)
+{
+    F__CHECK(List != NULL);
+    F__CHECK(List->items > 0);
 
-    return array;
+    return arrayFill(List, f_arena_frameAlloc(List->items * sizeof(void*)));
 }
 
 void f_list_reverse(FList* List)
@@ -61,6 +61,7 @@ extern void f_list_clearEx(FList* List, FCallFree* Free);
 
 extern FList* f_list_dup(const FList* List);
 extern void** f_list_toArray(const FList* List);
+extern void** f_list_toArrayFrame(const FList* List);
 
 extern void f_list_reverse(FList* List);
 extern void f_list_sort(FList* List, FCallListCompare* Compare);
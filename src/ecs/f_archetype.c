@@ -0,0 +1,231 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_archetype.v.h"
+#include <faur.v.h>
+
+#if F_CONFIG_ECS && F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+#if F_CONFIG_TRAIT_LOW_MEM
+    #define F__CHUNK_SIZE 1024
+#else
+    #define F__CHUNK_SIZE 16384
+#endif
+
+#define F__ALIGN_SIZE(Size)                      \
+    (((Size) + sizeof(FMaxMemAlignType) - 1)     \
+        & ~(size_t)(sizeof(FMaxMemAlignType) - 1))
+
+static FListIntr g_archetypes; // FListIntr<FArchetype*>
+
+static inline FComponentInstance* chunkCell(const FArchetypeChunk* Chunk,
+                                           unsigned Component,
+                                           unsigned Row)
+{
+    const FArchetype* a = Chunk->archetype;
+
+    return (FComponentInstance*)(void*)
+            ((uint8_t*)Chunk
+                + a->columnOffsets[Component]
+                + a->columnStrides[Component] * Row);
+}
+
+static FArchetype* archetypeNew(const FEntity* Entity)
+{
+    FArchetype* a = f_mem_mallocz(sizeof(FArchetype));
+
+    a->componentBits = F_ECS__BITS_NEW();
+    f_listintr_init(&a->chunks, FArchetypeChunk, listNode);
+
+    size_t rowSize = sizeof(FEntity*);
+
+    for(unsigned c = F_CONFIG_ECS_COM_NUM; c--; ) {
+        const FComponentInstance* instance = Entity->componentsTable[c];
+
+        if(instance != NULL) {
+            F_ECS__BITS_SET(a->componentBits, c);
+
+            a->columnStrides[c] =
+                F__ALIGN_SIZE(f_component__instanceSize(instance->component));
+
+            rowSize += a->columnStrides[c];
+        }
+    }
+
+    size_t headerSize = F__ALIGN_SIZE(sizeof(FArchetypeChunk));
+
+    a->rowsPerChunk = (unsigned)
+        ((F__CHUNK_SIZE > headerSize + rowSize)
+            ? (F__CHUNK_SIZE - headerSize) / rowSize : 1);
+
+    a->entitiesOffset = headerSize;
+    a->chunkSize =
+        headerSize + F__ALIGN_SIZE(a->rowsPerChunk * sizeof(FEntity*));
+
+    for(unsigned c = 0; c < F_CONFIG_ECS_COM_NUM; c++) {
+        if(a->columnStrides[c] > 0) {
+            a->columnOffsets[c] = a->chunkSize;
+            a->chunkSize += a->rowsPerChunk * a->columnStrides[c];
+        }
+    }
+
+    // Pick up this archetype in every system it satisfies
+    const FSystemMatch* match = f_system__matchGet(a->componentBits);
+
+    F_LIST_ITERATE(match->systemsActive, const FSystem*, system) {
+        f_list_addLast(system->runtime->archetypes, a);
+    }
+
+    F_LIST_ITERATE(match->systemsRest, const FSystem*, system) {
+        f_list_addLast(system->runtime->archetypes, a);
+    }
+
+    f_listintr_addLast(&g_archetypes, a);
+
+    return a;
+}
+
+static void archetypeFree(FArchetype* Archetype)
+{
+    f_listintr_clearEx(&Archetype->chunks, f_mem_free);
+    f_mem_free(Archetype->spareChunk);
+    F_ECS__BITS_FREE(Archetype->componentBits);
+
+    f_mem_free(Archetype);
+}
+
+static FArchetype* archetypeGet(const FEntity* Entity)
+{
+    F_LISTINTR_ITERATE(&g_archetypes, FArchetype*, a) {
+        if(F_ECS__BITS_EQUAL(a->componentBits, Entity->componentBits)) {
+            return a;
+        }
+    }
+
+    return archetypeNew(Entity);
+}
+
+void f_archetype__init(void)
+{
+    f_listintr_init(&g_archetypes, FArchetype, listNode);
+}
+
+void f_archetype__uninit(void)
+{
+    f_listintr_clearEx(&g_archetypes, (FCallFree*)archetypeFree);
+}
+
+void f_archetype__entityAdd(FEntity* Entity)
+{
+    FArchetype* a = archetypeGet(Entity);
+    FArchetypeChunk* chunk = f_listintr_getLast(&a->chunks);
+
+    if(chunk == NULL || chunk->num == a->rowsPerChunk) {
+        if(a->spareChunk) {
+            chunk = a->spareChunk;
+            a->spareChunk = NULL;
+        } else {
+            chunk = f_mem_malloc(a->chunkSize);
+            chunk->archetype = a;
+        }
+
+        chunk->num = 0;
+        f_listintr_addLast(&a->chunks, chunk);
+    }
+
+    unsigned row = chunk->num++;
+
+    f_archetype__chunkEntities(chunk)[row] = Entity;
+
+    for(unsigned c = F_CONFIG_ECS_COM_NUM; c--; ) {
+        FComponentInstance* instance = Entity->componentsTable[c];
+
+        if(instance == NULL) {
+            continue;
+        }
+
+        FComponentInstance* cell = chunkCell(chunk, c, row);
+
+        memcpy(cell, instance, f_component__instanceSize(instance->component));
+        f_pool_release(instance);
+
+        Entity->componentsTable[c] = cell;
+    }
+
+    Entity->chunk = chunk;
+    Entity->chunkRow = row;
+}
+
+void f_archetype__entityRemove(FEntity* Entity)
+{
+    FArchetypeChunk* chunk = Entity->chunk;
+    FArchetype* a = chunk->archetype;
+    unsigned row = Entity->chunkRow;
+
+    for(unsigned c = F_CONFIG_ECS_COM_NUM; c--; ) {
+        FComponentInstance* instance = Entity->componentsTable[c];
+
+        if(instance == NULL) {
+            continue;
+        }
+
+        if(instance->component->free) {
+            instance->component->free(instance->buffer);
+        }
+
+        Entity->componentsTable[c] = NULL;
+    }
+
+    // Fill the gap with the archetype's very last row to keep chunks packed
+    FArchetypeChunk* lastChunk = f_listintr_getLast(&a->chunks);
+    unsigned lastRow = --lastChunk->num;
+
+    if(lastChunk != chunk || lastRow != row) {
+        FEntity* moved = f_archetype__chunkEntities(lastChunk)[lastRow];
+
+        f_archetype__chunkEntities(chunk)[row] = moved;
+
+        for(unsigned c = F_CONFIG_ECS_COM_NUM; c--; ) {
+            if(a->columnOffsets[c] == 0) {
+                continue;
+            }
+
+            FComponentInstance* cell = chunkCell(chunk, c, row);
+
+            memcpy(cell,
+                   chunkCell(lastChunk, c, lastRow),
+                   a->columnStrides[c]);
+
+            moved->componentsTable[c] = cell;
+        }
+
+        moved->chunk = chunk;
+        moved->chunkRow = row;
+    }
+
+    if(lastChunk->num == 0) {
+        f_listintr_removeNode(&lastChunk->listNode);
+
+        if(a->spareChunk == NULL) {
+            a->spareChunk = lastChunk;
+        } else {
+            f_mem_free(lastChunk);
+        }
+    }
+
+    Entity->chunk = NULL;
+}
+#endif // F_CONFIG_ECS && F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
@@ -0,0 +1,70 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_ECS_ARCHETYPE_V_H
+#define F_INC_ECS_ARCHETYPE_V_H
+
+#include "f_archetype.p.h"
+
+typedef struct FArchetype FArchetype;
+typedef struct FArchetypeChunk FArchetypeChunk;
+
+#include "../data/f_listintr.v.h"
+#include "../ecs/f_ecs.v.h"
+#include "../ecs/f_entity.v.h"
+
+#if F_CONFIG_ECS && F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+//
+// With F_ECS_STORAGE_CHUNKS, entities that have the exact same components are
+// grouped in an archetype. An archetype stores its entities' component data in
+// fixed-size chunks, with one contiguous column per component type. Component
+// data is moved into a chunk when its entity is first matched to systems, and
+// chunks are kept packed by moving the last row into the freed slot, so do not
+// hold on to component pointers across frames.
+//
+struct FArchetype {
+    FListIntrNode listNode; // in the global archetypes list
+    F__EcsBitfield componentBits; // exact components this archetype has
+    FListIntr chunks; // FListIntr<FArchetypeChunk*>, all full except last
+    FArchetypeChunk* spareChunk; // last chunk to empty, kept for reuse
+    unsigned rowsPerChunk; // how many entities fit in a chunk
+    size_t chunkSize; // bytes, including the FArchetypeChunk header
+    size_t entitiesOffset; // FEntity*[rowsPerChunk] chunk byte offset
+    size_t columnOffsets[F_CONFIG_ECS_COM_NUM]; // 0 if component not used
+    size_t columnStrides[F_CONFIG_ECS_COM_NUM]; // bytes per column entry
+};
+
+struct FArchetypeChunk {
+    FListIntrNode listNode; // in parent archetype's chunks list
+    FArchetype* archetype; // parent archetype
+    unsigned num; // rows in use
+};
+
+extern void f_archetype__init(void);
+extern void f_archetype__uninit(void);
+
+extern void f_archetype__entityAdd(FEntity* Entity);
+extern void f_archetype__entityRemove(FEntity* Entity);
+
+static inline FEntity** f_archetype__chunkEntities(const FArchetypeChunk* Chunk)
+{
+    return (FEntity**)(void*)
+            ((uint8_t*)Chunk + Chunk->archetype->entitiesOffset);
+}
+#endif // F_CONFIG_ECS && F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+
+#endif // F_INC_ECS_ARCHETYPE_V_H
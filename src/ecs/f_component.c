@@ -28,10 +28,7 @@ void f_component__init(void)
 
         component->runtime->bitId = c;
 
-        g_pools[c] = f_pool_new(
-                        component->size
-                            + (unsigned)(sizeof(FComponentInstance)
-                            - sizeof(FMaxMemAlignType)));
+        g_pools[c] = f_pool_newShared(f_component__instanceSize(component));
     }
 }
 
@@ -33,6 +33,11 @@ struct FComponentInstance {
 
 extern const FComponent* const f_component__array[];
 
+static inline size_t f_component__instanceSize(const FComponent* Component)
+{
+    return offsetof(FComponentInstance, buffer) + Component->size;
+}
+
 extern void f_component__init(void);
 extern void f_component__uninit(void);
 
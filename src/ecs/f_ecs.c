@@ -30,6 +30,11 @@ static void f_ecs__init(void)
                 F_CONFIG_ECS_SYS_NUM);
 
     f_component__init();
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        f_archetype__init();
+    #endif
+
     f_system__init();
     f_entity__init();
 }
@@ -38,6 +43,11 @@ static void f_ecs__uninit(void)
 {
     f_entity__uninit();
     f_system__uninit();
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        f_archetype__uninit();
+    #endif
+
     f_component__uninit();
 }
 
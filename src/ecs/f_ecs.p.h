@@ -22,6 +22,9 @@
 
 #include "../data/f_bitfield.p.h"
 
+#define F_ECS_STORAGE_POOL 0 // each component instance is a pool object
+#define F_ECS_STORAGE_CHUNKS 1 // same-signature entities packed in chunks
+
 #if F_CONFIG_ECS_COM_NUM <= 32
     typedef uint32_t F__EcsBitfield;
 #elif F_CONFIG_ECS_COM_NUM <= 64
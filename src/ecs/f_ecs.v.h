@@ -28,19 +28,42 @@ extern const FPack f_pack__ecs;
 
 #if F_CONFIG_ECS_COM_NUM <= 32
     #define F_ECS__BITS_NEW() ((uint32_t)0)
+    #define F_ECS__BITS_DUP(Bits) (Bits)
     #define F_ECS__BITS_FREE(Bits)
     #define F_ECS__BITS_SET(Bits, Index) ((Bits) |= (uint32_t)1 << (Index))
     #define F_ECS__BITS_TEST(Bits, Mask) (((Bits) & (Mask)) == (Mask))
+    #define F_ECS__BITS_TEST_ANY(Bits, Mask) (((Bits) & (Mask)) != 0)
+    #define F_ECS__BITS_EQUAL(A, B) ((A) == (B))
+    #define F_ECS__BITS_HASH(Bits) f_ecs__bitsHash(Bits)
 #elif F_CONFIG_ECS_COM_NUM <= 64
     #define F_ECS__BITS_NEW() ((uint64_t)0)
+    #define F_ECS__BITS_DUP(Bits) (Bits)
     #define F_ECS__BITS_FREE(Bits)
     #define F_ECS__BITS_SET(Bits, Index) ((Bits) |= (uint64_t)1 << (Index))
     #define F_ECS__BITS_TEST(Bits, Mask) (((Bits) & (Mask)) == (Mask))
+    #define F_ECS__BITS_TEST_ANY(Bits, Mask) (((Bits) & (Mask)) != 0)
+    #define F_ECS__BITS_EQUAL(A, B) ((A) == (B))
+    #define F_ECS__BITS_HASH(Bits) f_ecs__bitsHash(Bits)
 #else
     #define F_ECS__BITS_NEW() f_bitfield_new(F_CONFIG_ECS_COM_NUM)
+    #define F_ECS__BITS_DUP(Bits) f_bitfield_dup(Bits)
     #define F_ECS__BITS_FREE(Bits) f_bitfield_free(Bits)
     #define F_ECS__BITS_SET(Bits, Index) f_bitfield_set((Bits), (Index))
     #define F_ECS__BITS_TEST(Bits, Mask) f_bitfield_testMask((Bits), (Mask))
+    #define F_ECS__BITS_TEST_ANY(Bits, Mask) f_bitfield_testAny((Bits), (Mask))
+    #define F_ECS__BITS_EQUAL(A, B) f_bitfield_testEqual((A), (B))
+    #define F_ECS__BITS_HASH(Bits) f_bitfield_hash(Bits)
+#endif
+
+#if F_CONFIG_ECS_COM_NUM <= 64
+static inline unsigned f_ecs__bitsHash(uint64_t Bits)
+{
+    // Fold and mix so the low bits used for slots depend on every component
+    Bits ^= Bits >> 32;
+    Bits *= 0x9e3779b97f4a7c15u;
+
+    return (unsigned)(Bits >> 32);
+}
 #endif
 
 #endif // F_INC_ECS_ECS_V_H
@@ -38,18 +38,63 @@ static inline bool listIsIn(const FEntity* Entity, FEntityList List)
     return Entity->uniqueList == List;
 }
 
+// Worker threads would race on the shared lists
+static inline void listsCheck(void)
+{
+    if(f_system__parallelInProgress) {
+        F__FATAL("Entity lists changed during a parallel system run");
+    }
+}
+
 static inline void listAddTo(FEntity* Entity, FEntityList List)
 {
+    listsCheck();
+
     f_listintr_addLast(&g_lists[List], Entity);
     Entity->uniqueList = List;
 }
 
 static inline void listMoveTo(FEntity* Entity, FEntityList List)
 {
+    listsCheck();
+
     f_listintr_removeNode(&Entity->node);
     listAddTo(Entity, List);
 }
 
+static inline bool componentsCanAdd(const FEntity* Entity)
+{
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        // Component data was already moved to a chunk
+        if(Entity->chunk != NULL) {
+            return false;
+        }
+    #endif
+
+    return listIsIn(Entity, F_LIST__NEW);
+}
+
+#if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+static void systemsRemove(FEntity* Entity)
+{
+    if(Entity->matchingSystems == NULL) {
+        return;
+    }
+
+    F_LIST_ITERATE(
+        Entity->matchingSystems->systemsActive, const FSystem*, system) {
+
+        f_system__entityRemove(system, Entity);
+    }
+
+    F_LIST_ITERATE(
+        Entity->matchingSystems->systemsRest, const FSystem*, system) {
+
+        f_system__entityRemove(system, Entity);
+    }
+}
+#endif
+
 void f_entity__init(void)
 {
     for(int i = F_LIST__NUM; i--; ) {
@@ -74,19 +119,15 @@ void f_entity__tick(void)
 
     // Check what systems the new entities match
     F_LISTINTR_ITERATE(&g_lists[F_LIST__NEW], FEntity*, e) {
-        for(unsigned s = F_CONFIG_ECS_SYS_NUM; s--; ) {
-            const FSystem* system = f_system__array[s];
-
-            if(F_ECS__BITS_TEST(
-                e->componentBits, system->runtime->componentBits)) {
-
-                if(system->onlyActiveEntities) {
-                    f_list_addLast(e->matchingSystemsActive, (FSystem*)system);
-                } else {
-                    f_list_addLast(e->matchingSystemsRest, (FSystem*)system);
-                }
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+            // Move component data from pools to the archetype's chunks
+            if(e->chunk == NULL) {
+                f_archetype__entityAdd(e);
             }
-        }
+        #endif
+
+        // Entities with the same components share one list of systems
+        e->matchingSystems = f_system__matchGet(e->componentBits);
 
         listAddTo(e, F_LIST__RESTORE);
     }
@@ -94,26 +135,32 @@ void f_entity__tick(void)
     // Add entities to the systems they match
     F_LISTINTR_ITERATE(&g_lists[F_LIST__RESTORE], FEntity*, e) {
         #if F_CONFIG_DEBUG
-            if(f_list_sizeIsEmpty(e->matchingSystemsActive)
-                && f_list_sizeIsEmpty(e->matchingSystemsRest)) {
+            if(f_list_sizeIsEmpty(e->matchingSystems->systemsActive)
+                && f_list_sizeIsEmpty(e->matchingSystems->systemsRest)) {
 
                 f_out__warning(
                     "Entity %s was not matched to any systems", e->id);
             }
         #endif
 
-        if(!F_FLAGS_TEST_ANY(e->flags, F_ENTITY__ACTIVE_REMOVED)) {
-            F_LIST_ITERATE(e->matchingSystemsActive, const FSystem*, system) {
-                f_list_addLast(e->systemNodesActive,
-                               f_list_addLast(system->runtime->entities, e));
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+            if(!F_FLAGS_TEST_ANY(e->flags, F_ENTITY__ACTIVE_REMOVED)) {
+                F_LIST_ITERATE(e->matchingSystems->systemsActive,
+                               const FSystem*,
+                               system) {
+
+                    f_system__entityAdd(system, e);
+                }
             }
-        }
 
-        F_LIST_ITERATE(e->matchingSystemsRest, const FSystem*, system) {
-            f_list_addLast(e->systemNodesEither,
-                           f_list_addLast(system->runtime->entities, e));
-        }
+            F_LIST_ITERATE(
+                e->matchingSystems->systemsRest, const FSystem*, system) {
 
+                f_system__entityAdd(system, e);
+            }
+        #endif
+
+        F_FLAGS_SET(e->flags, F_ENTITY__IN_SYSTEMS);
         listAddTo(e, F_LIST__DEFAULT);
     }
 
@@ -129,9 +176,11 @@ void f_entity__flushFromSystems(void)
             f_out__info("%s removed from all systems", e->id);
         }
 
-        f_list_clearEx(e->systemNodesActive, (FCallFree*)f_list_removeNode);
-        f_list_clearEx(e->systemNodesEither, (FCallFree*)f_list_removeNode);
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+            systemsRemove(e);
+        #endif
 
+        F_FLAGS_CLEAR(e->flags, F_ENTITY__IN_SYSTEMS);
         listAddTo(e, canDelete(e) ? F_LIST__FREE : F_LIST__DEFAULT);
     }
 
@@ -145,7 +194,14 @@ void f_entity__flushFromSystemsActive(FEntity* Entity)
     }
 
     F_FLAGS_SET(Entity->flags, F_ENTITY__ACTIVE_REMOVED);
-    f_list_clearEx(Entity->systemNodesActive, (FCallFree*)f_list_removeNode);
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+        F_LIST_ITERATE(
+            Entity->matchingSystems->systemsActive, const FSystem*, system) {
+
+            f_system__entityRemove(system, Entity);
+        }
+    #endif
 
     if(F_FLAGS_TEST_ANY(Entity->flags, F_ENTITY__REMOVE_INACTIVE)) {
         f_entity_removedSet(Entity);
@@ -158,15 +214,16 @@ FEntity* f_entity_new(const char* Id)
         F__FATAL("f_entity_new(%s): Free in progress", Id);
     }
 
+    if(f_system__parallelInProgress) {
+        F__FATAL("f_entity_new(%s): Parallel system run in progress", Id);
+    }
+
     FEntity* e = f_pool__alloc(F_POOL__ENTITY);
 
     listAddTo(e, F_LIST__NEW);
 
     e->id = "FEntity";
-    e->matchingSystemsActive = f_list_new();
-    e->matchingSystemsRest = f_list_new();
-    e->systemNodesActive = f_list_new();
-    e->systemNodesEither = f_list_new();
+
     e->componentBits = F_ECS__BITS_NEW();
     e->lastActive = f_fps_ticksGet() - 1;
 
@@ -199,10 +256,14 @@ void f_entity__free(FEntity* Entity)
 
     f_listintr_removeNode(&Entity->node);
     f_listintr_removeNode(&Entity->collectionNode);
-    f_list_free(Entity->matchingSystemsActive);
-    f_list_free(Entity->matchingSystemsRest);
-    f_list_freeEx(Entity->systemNodesActive, (FCallFree*)f_list_removeNode);
-    f_list_freeEx(Entity->systemNodesEither, (FCallFree*)f_list_removeNode);
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        if(Entity->chunk) {
+            f_archetype__entityRemove(Entity);
+        }
+    #else
+        systemsRemove(Entity);
+    #endif
 
     for(unsigned c = F_CONFIG_ECS_COM_NUM; c--; ) {
         f_component__instanceFree(Entity->componentsTable[c]);
@@ -429,6 +490,10 @@ void f_entity_activeSet(FEntity* Entity)
         F__FATAL("f_entity_activeSet: Free in progress");
     }
 
+    if(f_system__parallelInProgress) {
+        F__FATAL("f_entity_activeSet: Parallel system run in progress");
+    }
+
     if(Entity->muteCount > 0
         || F_FLAGS_TEST_ANY(Entity->flags, F_ENTITY__REMOVED)) {
 
@@ -448,11 +513,16 @@ void f_entity_activeSet(FEntity* Entity)
     if(F_FLAGS_TEST_ANY(Entity->flags, F_ENTITY__ACTIVE_REMOVED)) {
         F_FLAGS_CLEAR(Entity->flags, F_ENTITY__ACTIVE_REMOVED);
 
-        // Add entity back to active-only systems
-        F_LIST_ITERATE(Entity->matchingSystemsActive, const FSystem*, system) {
-            f_list_addLast(Entity->systemNodesActive,
-                           f_list_addLast(system->runtime->entities, Entity));
-        }
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+            // Add entity back to active-only systems
+            F_LIST_ITERATE(
+                Entity->matchingSystems->systemsActive,
+                const FSystem*,
+                system) {
+
+                f_system__entityAdd(system, Entity);
+            }
+        #endif
     }
 }
 
@@ -507,7 +577,7 @@ void* f_entity_componentAdd(FEntity* Entity, const FComponent* Component)
         F__FATAL("f_entity_componentAdd: Free in progress");
     }
 
-    if(!listIsIn(Entity, F_LIST__NEW)) {
+    if(!componentsCanAdd(Entity)) {
         F__FATAL("f_entity_componentAdd(%s, %s): Too late",
                  Entity->id,
                  Component->stringId);
@@ -654,9 +724,7 @@ void f_entity_muteDec(FEntity* Entity)
     }
 
     if(--Entity->muteCount == 0) {
-        if(!f_list_sizeIsEmpty(Entity->matchingSystemsActive)
-            || !f_list_sizeIsEmpty(Entity->matchingSystemsRest)) {
-
+        if(Entity->matchingSystems != NULL) {
             if(listIsIn(Entity, F_LIST__FLUSH)) {
                 // Entity was muted and unmuted before it left systems
                 listMoveTo(Entity, F_LIST__DEFAULT);
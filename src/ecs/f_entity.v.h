@@ -21,6 +21,7 @@
 #include "f_entity.p.h"
 
 #include "../data/f_list.v.h"
+#include "../ecs/f_archetype.v.h"
 #include "../ecs/f_collection.v.h"
 #include "../ecs/f_component.v.h"
 #include "../ecs/f_system.v.h"
@@ -31,6 +32,7 @@
 #define F_ENTITY__REMOVED F_FLAGS_BIT(3) // marked for removal, may have refs
 #define F_ENTITY__REMOVE_INACTIVE F_FLAGS_BIT(4) // mark for removal if kicked
 #define F_ENTITY__ALLOC_STRING_ID F_FLAGS_BIT(5) // free string ID if set
+#define F_ENTITY__IN_SYSTEMS F_FLAGS_BIT(6) // added to its matched systems
 
 typedef enum {
     F_LIST__DEFAULT, // no pending changes
@@ -48,10 +50,13 @@ struct FEntity {
     FEntityList uniqueList; // bucket list this entity is in
     FListIntrNode collectionNode; // collection list node
     const FCollection* collectionList; // collection backpointer
-    FList* matchingSystemsActive; // FList<const FSystem*>
-    FList* matchingSystemsRest; // FList<const FSystem*>
-    FList* systemNodesActive; // FList<FListNode*> in active-only FSystem lists
-    FList* systemNodesEither; // FList<FListNode*> in rest FSystem lists
+    const FSystemMatch* matchingSystems; // shared by signature, NULL if new
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        FArchetypeChunk* chunk; // component data chunk, NULL until matched
+        unsigned chunkRow; // entity's row in its chunk
+    #elif F_CONFIG_ECS_SYS_NUM > 0
+        unsigned systemSlots[F_CONFIG_ECS_SYS_NUM]; // 1-based index or 0
+    #endif
     F__EcsBitfield componentBits; // each component's bit ID is set
     unsigned lastActive; // frame when f_entity_activeSet was last called
     int references; // if >0, then the entity lingers in the removed limbo list
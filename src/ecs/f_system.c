@@ -19,13 +19,56 @@
 #include <faur.v.h>
 
 #if F_CONFIG_ECS
+#define F__MATCH_SLOTS 256
+#define F__SLICE_ENTITIES_MIN 128
+
+typedef struct {
+    const FSystem* system;
+    unsigned start, end; // entity index range in the system's array
+} FSystemWork;
+
+static FHash* g_matches; // FHash<F__EcsBitfield*, FSystemMatch*>
+static FSystemWork* g_work; // [g_workCap] items for f_system_runParallel
+static unsigned g_workCap;
+
+bool f_system__parallelInProgress; // Set while handlers run on workers
+
+static unsigned matchHash(const F__EcsBitfield* Key)
+{
+    return F_ECS__BITS_HASH(*Key);
+}
+
+static bool matchEqual(const F__EcsBitfield* KeyA, const F__EcsBitfield* KeyB)
+{
+    return F_ECS__BITS_EQUAL(*KeyA, *KeyB);
+}
+
+static void matchFree(FSystemMatch* Match)
+{
+    f_list_free(Match->systemsActive);
+    f_list_free(Match->systemsRest);
+    F_ECS__BITS_FREE(Match->componentBits);
+
+    f_mem_free(Match);
+}
+
 void f_system__init(void)
 {
+    g_matches = f_hash_new((FCallHashFunction*)matchHash,
+                           (FCallHashEqual*)matchEqual,
+                           NULL,
+                           F__MATCH_SLOTS);
+
     for(unsigned s = F_CONFIG_ECS_SYS_NUM; s--; ) {
         const FSystem* sys = f_system__array[s];
 
-        sys->runtime->entities = f_list_new();
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+            sys->runtime->archetypes = f_list_new();
+        #endif
+
         sys->runtime->componentBits = F_ECS__BITS_NEW();
+        sys->runtime->writeBits = F_ECS__BITS_NEW();
+        sys->runtime->index = s;
 
         for(unsigned c = sys->componentsNum; c--; ) {
             if(sys->components[c] == NULL) {
@@ -37,6 +80,24 @@ void f_system__init(void)
 
             F_ECS__BITS_SET(sys->runtime->componentBits,
                             sys->components[c]->runtime->bitId);
+
+            if(sys->componentsWrite == NULL) {
+                // Without a declared write set, assume it changes everything
+                F_ECS__BITS_SET(sys->runtime->writeBits,
+                                sys->components[c]->runtime->bitId);
+            }
+        }
+
+        for(unsigned c = sys->componentsWriteNum; c--; ) {
+            if(sys->componentsWrite[c] == NULL) {
+                F__FATAL("%s write component %u/%u is NULL",
+                         sys->stringId,
+                         c + 1,
+                         sys->componentsWriteNum);
+            }
+
+            F_ECS__BITS_SET(sys->runtime->writeBits,
+                            sys->componentsWrite[c]->runtime->bitId);
         }
     }
 }
@@ -46,28 +107,298 @@ void f_system__uninit(void)
     for(unsigned s = F_CONFIG_ECS_SYS_NUM; s--; ) {
         const FSystem* system = f_system__array[s];
 
-        f_list_free(system->runtime->entities);
+        #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+            f_list_free(system->runtime->archetypes);
+        #else
+            f_mem_free(system->runtime->entities);
+            f_mem_free(system->runtime->entitiesScratch);
+        #endif
+
         F_ECS__BITS_FREE(system->runtime->componentBits);
+        F_ECS__BITS_FREE(system->runtime->writeBits);
     }
+
+    f_hash_freeEx(g_matches, (FCallFree*)matchFree);
+    f_mem_free(g_work);
 }
 
-void f_system_run(const FSystem* System)
+const FSystemMatch* f_system__matchGet(const F__EcsBitfield ComponentBits)
 {
-    F__CHECK(System != NULL);
+    FSystemMatch* m = f_hash_get(g_matches, &ComponentBits);
+
+    if(m) {
+        return m;
+    }
+
+    // First entity with this signature, test it against every system once
+    m = f_mem_malloc(sizeof(FSystemMatch));
+
+    m->componentBits = F_ECS__BITS_DUP(ComponentBits);
+    m->systemsActive = f_list_new();
+    m->systemsRest = f_list_new();
+
+    for(unsigned s = F_CONFIG_ECS_SYS_NUM; s--; ) {
+        const FSystem* system = f_system__array[s];
+
+        if(F_ECS__BITS_TEST(ComponentBits, system->runtime->componentBits)) {
+            if(system->onlyActiveEntities) {
+                f_list_addLast(m->systemsActive, (FSystem*)system);
+            } else {
+                f_list_addLast(m->systemsRest, (FSystem*)system);
+            }
+        }
+    }
+
+    f_hash_add(g_matches, &m->componentBits, m);
+
+    return m;
+}
+
+// Returns whichever of the two buffers ended up with the sorted entities
+static FEntity** sortEntities(FEntity** Entities, FEntity** Scratch, unsigned Num, FCallSystemSort* Compare)
+{
+    FEntity** src = Entities;
+    FEntity** dst = Scratch;
+
+    // Bottom-up merge sort, stable so equal keys keep last frame's order
+    for(unsigned width = 1; width < Num; width *= 2) {
+        for(unsigned start = 0; start < Num; start += 2 * width) {
+            unsigned a = start;
+            unsigned aEnd = f_math_minu(start + width, Num);
+            unsigned b = aEnd;
+            unsigned bEnd = f_math_minu(start + 2 * width, Num);
+            unsigned d = start;
+
+            while(a < aEnd && b < bEnd) {
+                if(Compare(src[a], src[b]) <= 0) {
+                    dst[d++] = src[a++];
+                } else {
+                    dst[d++] = src[b++];
+                }
+            }
+
+            while(a < aEnd) {
+                dst[d++] = src[a++];
+            }
 
-    if(System->onlyActiveEntities) {
-        F_LIST_ITERATE(System->runtime->entities, FEntity*, entity) {
-            if(f_entity_activeGet(entity)) {
-                System->handler(entity);
+            while(b < bEnd) {
+                dst[d++] = src[b++];
+            }
+        }
+
+        FEntity** swap = src;
+
+        src = dst;
+        dst = swap;
+    }
+
+    return src;
+}
+
+#if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+void f_system__entityAdd(const FSystem* System, FEntity* Entity)
+{
+    F__SystemRuntime* r = System->runtime;
+
+    if(Entity->systemSlots[r->index] != 0) {
+        return;
+    }
+
+    if(r->entitiesNum == r->entitiesCap) {
+        unsigned cap = r->entitiesCap == 0 ? 16 : r->entitiesCap * 2;
+        FEntity** entities = f_mem_malloc(cap * sizeof(FEntity*));
+
+        if(r->entities) {
+            memcpy(entities, r->entities, r->entitiesNum * sizeof(FEntity*));
+            f_mem_free(r->entities);
+        }
+
+        r->entities = entities;
+        r->entitiesCap = cap;
+    }
+
+    r->entities[r->entitiesNum++] = Entity;
+    Entity->systemSlots[r->index] = r->entitiesNum;
+}
+
+void f_system__entityRemove(const FSystem* System, FEntity* Entity)
+{
+    F__SystemRuntime* r = System->runtime;
+    unsigned slot = Entity->systemSlots[r->index];
+
+    if(slot == 0) {
+        return;
+    }
+
+    // Move the last entity into the vacated slot
+    FEntity* last = r->entities[--r->entitiesNum];
+
+    r->entities[slot - 1] = last;
+    last->systemSlots[r->index] = slot;
+
+    Entity->systemSlots[r->index] = 0;
+}
+
+static void runArray(const FSystem* System, bool DeferKicks)
+{
+    const F__SystemRuntime* r = System->runtime;
+
+    // Handlers may append entities, so re-read the array on each step
+    if(System->onlyActiveEntities && !DeferKicks) {
+        for(unsigned i = 0; i < r->entitiesNum; ) {
+            FEntity* e = r->entities[i];
+
+            if(f_entity_activeGet(e)) {
+                System->handler(e);
+                i++;
             } else {
-                f_entity__flushFromSystemsActive(entity);
+                // Swap-removes e, so slot i now holds an unvisited entity
+                f_entity__flushFromSystemsActive(e);
             }
         }
     } else {
-        F_LIST_ITERATE(System->runtime->entities, FEntity*, entity) {
-            System->handler(entity);
+        for(unsigned i = 0; i < r->entitiesNum; i++) {
+            FEntity* e = r->entities[i];
+
+            if(!System->onlyActiveEntities || f_entity_activeGet(e)) {
+                System->handler(e);
+            }
+        }
+    }
+}
+
+static void runSlice(const FSystem* System, unsigned Start, unsigned End)
+{
+    FEntity* const* entities = System->runtime->entities;
+
+    for(unsigned i = Start; i < End; i++) {
+        // Inactive entities are kicked after the parallel run
+        if(!System->onlyActiveEntities || f_entity_activeGet(entities[i])) {
+            System->handler(entities[i]);
         }
     }
+}
+
+static void kickArray(const FSystem* System)
+{
+    const F__SystemRuntime* r = System->runtime;
+
+    for(unsigned i = 0; i < r->entitiesNum; ) {
+        FEntity* e = r->entities[i];
+
+        if(f_entity_activeGet(e)) {
+            i++;
+        } else {
+            f_entity__flushFromSystemsActive(e);
+        }
+    }
+}
+
+static void sortArray(const FSystem* System, FCallSystemSort* Compare)
+{
+    F__SystemRuntime* r = System->runtime;
+    unsigned num = r->entitiesNum;
+
+    if(num < 2) {
+        return;
+    }
+
+    if(r->scratchCap < num) {
+        f_mem_free(r->entitiesScratch);
+
+        r->entitiesScratch = f_mem_malloc(r->entitiesCap * sizeof(FEntity*));
+        r->scratchCap = r->entitiesCap;
+    }
+
+    if(sortEntities(r->entities, r->entitiesScratch, num, Compare)
+        != r->entities) {
+
+        FEntity** entities = r->entities;
+
+        r->entities = r->entitiesScratch;
+        r->entitiesScratch = entities;
+
+        unsigned cap = r->scratchCap;
+
+        r->scratchCap = r->entitiesCap;
+        r->entitiesCap = cap;
+    }
+
+    for(unsigned i = num; i--; ) {
+        r->entities[i]->systemSlots[r->index] = i + 1;
+    }
+}
+#else // F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+static void runEntities(const FSystem* System, FEntity* const* Entities, unsigned Num)
+{
+    for(unsigned i = 0; i < Num; i++) {
+        if(System->onlyActiveEntities && !f_entity_activeGet(Entities[i])) {
+            f_entity__flushFromSystemsActive(Entities[i]);
+        } else {
+            System->handler(Entities[i]);
+        }
+    }
+}
+
+static inline bool entityIsIn(const FSystem* System, const FEntity* Entity)
+{
+    return F_FLAGS_TEST_ANY(Entity->flags, F_ENTITY__IN_SYSTEMS)
+        && !(System->onlyActiveEntities
+                && F_FLAGS_TEST_ANY(Entity->flags, F_ENTITY__ACTIVE_REMOVED));
+}
+
+static void runChunks(const FSystem* System, bool DeferKicks)
+{
+    F_LIST_ITERATE(System->runtime->archetypes, const FArchetype*, a) {
+        F_LISTINTR_ITERATE(&a->chunks, const FArchetypeChunk*, chunk) {
+            FEntity** entities = f_archetype__chunkEntities(chunk);
+
+            for(unsigned r = 0; r < chunk->num; r++) {
+                FEntity* e = entities[r];
+
+                if(!entityIsIn(System, e)) {
+                    continue;
+                }
+
+                if(System->onlyActiveEntities && !f_entity_activeGet(e)) {
+                    if(!DeferKicks) {
+                        f_entity__flushFromSystemsActive(e);
+                    }
+                } else {
+                    System->handler(e);
+                }
+            }
+        }
+    }
+}
+
+static void kickChunks(const FSystem* System)
+{
+    F_LIST_ITERATE(System->runtime->archetypes, const FArchetype*, a) {
+        F_LISTINTR_ITERATE(&a->chunks, const FArchetypeChunk*, chunk) {
+            FEntity** entities = f_archetype__chunkEntities(chunk);
+
+            for(unsigned r = 0; r < chunk->num; r++) {
+                if(entityIsIn(System, entities[r])
+                    && !f_entity_activeGet(entities[r])) {
+
+                    f_entity__flushFromSystemsActive(entities[r]);
+                }
+            }
+        }
+    }
+}
+#endif
+
+void f_system_run(const FSystem* System)
+{
+    F__CHECK(System != NULL);
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        runChunks(System, false);
+    #else
+        runArray(System, false);
+    #endif
 
     f_entity__flushFromSystems();
 }
@@ -77,8 +408,170 @@ void f_system_runEx(const FSystem* System, FCallSystemSort* SortCompare)
     F__CHECK(System != NULL);
     F__CHECK(SortCompare != NULL);
 
-    f_list_sort(System->runtime->entities, (FCallListCompare*)SortCompare);
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        // Chunk order is fixed, so gather the entities to sort them
+        unsigned num = 0;
+
+        F_LIST_ITERATE(System->runtime->archetypes, const FArchetype*, a) {
+            F_LISTINTR_ITERATE(&a->chunks, const FArchetypeChunk*, chunk) {
+                num += chunk->num;
+            }
+        }
+
+        if(num > 0) {
+            FEntity** entities = f_arena_frameAlloc(num * sizeof(FEntity*));
+            FEntity** scratch = f_arena_frameAlloc(num * sizeof(FEntity*));
+
+            num = 0;
+
+            F_LIST_ITERATE(System->runtime->archetypes, const FArchetype*, a) {
+                F_LISTINTR_ITERATE(&a->chunks, const FArchetypeChunk*, c) {
+                    FEntity** chunkEntities = f_archetype__chunkEntities(c);
 
-    f_system_run(System);
+                    for(unsigned r = 0; r < c->num; r++) {
+                        if(entityIsIn(System, chunkEntities[r])) {
+                            entities[num++] = chunkEntities[r];
+                        }
+                    }
+                }
+            }
+
+            runEntities(System,
+                        sortEntities(entities, scratch, num, SortCompare),
+                        num);
+        }
+    #else
+        sortArray(System, SortCompare);
+
+        // Kicking swap-removes entities, which would break the sorted order
+        runArray(System, true);
+
+        if(System->onlyActiveEntities) {
+            kickArray(System);
+        }
+    #endif
+
+    f_entity__flushFromSystems();
+}
+
+static bool systemsConflict(const FSystem* A, const FSystem* B)
+{
+    return F_ECS__BITS_TEST_ANY(A->runtime->writeBits,
+                                B->runtime->componentBits)
+        || F_ECS__BITS_TEST_ANY(B->runtime->writeBits,
+                                A->runtime->componentBits)
+        || F_ECS__BITS_TEST_ANY(A->runtime->writeBits,
+                                B->runtime->writeBits);
+}
+
+static void workAdd(unsigned* Num, const FSystem* System, unsigned Start, unsigned End)
+{
+    if(*Num == g_workCap) {
+        unsigned cap = g_workCap == 0 ? 16 : g_workCap * 2;
+        FSystemWork* work = f_mem_malloc(cap * sizeof(FSystemWork));
+
+        if(g_work) {
+            memcpy(work, g_work, *Num * sizeof(FSystemWork));
+            f_mem_free(g_work);
+        }
+
+        g_work = work;
+        g_workCap = cap;
+    }
+
+    g_work[*Num].system = System;
+    g_work[*Num].start = Start;
+    g_work[*Num].end = End;
+
+    (*Num)++;
+}
+
+static void workRun(void* Context, unsigned Index)
+{
+    const FSystemWork* w = &((const FSystemWork*)Context)[Index];
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        runChunks(w->system, true);
+    #else
+        runSlice(w->system, w->start, w->end);
+    #endif
+}
+
+// Handlers run on worker threads, so they must not create, remove, or
+// activate entities, or otherwise add or move them between entity lists
+void f_system_runParallel(const FSystem* const* Systems, unsigned NumSystems)
+{
+    F__CHECK(Systems != NULL);
+    F__CHECK(NumSystems <= F_CONFIG_ECS_SYS_NUM);
+
+    // Systems go in the earliest wave after every earlier system they
+    // conflict with, so the given order holds wherever it matters
+    unsigned waves[F_CONFIG_ECS_SYS_NUM];
+    unsigned wavesNum = 0;
+
+    for(unsigned s = 0; s < NumSystems; s++) {
+        F__CHECK(Systems[s] != NULL);
+
+        waves[s] = 0;
+
+        for(unsigned prev = 0; prev < s; prev++) {
+            if(waves[prev] >= waves[s]
+                && systemsConflict(Systems[s], Systems[prev])) {
+
+                waves[s] = waves[prev] + 1;
+            }
+        }
+
+        wavesNum = f_math_maxu(wavesNum, waves[s] + 1);
+    }
+
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+        unsigned threads = f_platform_api__workThreadsGet();
+    #endif
+
+    f_system__parallelInProgress = true;
+
+    for(unsigned wave = 0; wave < wavesNum; wave++) {
+        unsigned workNum = 0;
+
+        for(unsigned s = 0; s < NumSystems; s++) {
+            if(waves[s] != wave) {
+                continue;
+            }
+
+            #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+                workAdd(&workNum, Systems[s], 0, 0);
+            #else
+                // Split big entity arrays into one slice per thread
+                unsigned num = Systems[s]->runtime->entitiesNum;
+                unsigned slices = f_math_minu(
+                    threads,
+                    (num + F__SLICE_ENTITIES_MIN - 1) / F__SLICE_ENTITIES_MIN);
+
+                for(unsigned i = 0; i < slices; i++) {
+                    workAdd(&workNum,
+                            Systems[s],
+                            num / slices * i,
+                            i == slices - 1 ? num : num / slices * (i + 1));
+                }
+            #endif
+        }
+
+        f_platform_api__workRun(workRun, g_work, workNum);
+    }
+
+    f_system__parallelInProgress = false;
+
+    for(unsigned s = 0; s < NumSystems; s++) {
+        if(Systems[s]->onlyActiveEntities) {
+            #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+                kickChunks(Systems[s]);
+            #else
+                kickArray(Systems[s]);
+            #endif
+        }
+    }
+
+    f_entity__flushFromSystems();
 }
 #endif // F_CONFIG_ECS
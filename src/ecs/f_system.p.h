@@ -32,8 +32,18 @@ typedef void FCallSystemHandler(FEntity* Entity);
 typedef int FCallSystemSort(const FEntity* A, const FEntity* B);
 
 typedef struct {
-    FList* entities; // entities currently picked up by this system
+    #if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_CHUNKS
+        FList* archetypes; // archetypes that have all of the components
+    #else
+        FEntity** entities; // [entitiesCap] entities picked up by this system
+        FEntity** entitiesScratch; // [scratchCap] merge buffer for sorting
+        unsigned entitiesNum; // number of entities in the array
+        unsigned entitiesCap; // allocated length of entities array
+        unsigned scratchCap; // allocated length of entitiesScratch
+    #endif
     F__EcsBitfield componentBits; // IDs of components that this system works on
+    F__EcsBitfield writeBits; // IDs of components that this system changes
+    unsigned index; // position in f_system__array
 } F__SystemRuntime;
 
 struct FSystem {
@@ -43,6 +53,8 @@ struct FSystem {
     bool onlyActiveEntities; // kick out entities that are not marked active
     const FComponent** components; // [componentsNum]
     unsigned componentsNum; // length of components array
+    const FComponent* const* componentsWrite; // [componentsWriteNum] or NULL
+    unsigned componentsWriteNum; // if componentsWrite is NULL, all are written
 };
 
 #define F_SYSTEM(Name, Handler, OnlyActiveEntities, ...)              \
@@ -58,7 +70,29 @@ struct FSystem {
                             / sizeof(const FComponent*),              \
     }
 
+#define F_SYSTEM_WRITES(Name, ...)                                    \
+    static const FComponent* const                                    \
+        F_GLUE2(f__system_writes_, Name)[] = {__VA_ARGS__}
+
+#define F_SYSTEM_RW(Name, Handler, OnlyActiveEntities, ...)           \
+    static F__SystemRuntime F_GLUE2(f__system_runtime_, Name);        \
+                                                                      \
+    const FSystem Name = {                                            \
+        .runtime = &F_GLUE2(f__system_runtime_, Name),                \
+        .stringId = F_STRINGIFY(Name),                                \
+        .handler = Handler,                                           \
+        .onlyActiveEntities = OnlyActiveEntities,                     \
+        .components = (const FComponent*[]){__VA_ARGS__},             \
+        .componentsNum = sizeof((const FComponent*[]){__VA_ARGS__})   \
+                            / sizeof(const FComponent*),              \
+        .componentsWrite = F_GLUE2(f__system_writes_, Name),          \
+        .componentsWriteNum =                                         \
+            sizeof(F_GLUE2(f__system_writes_, Name))                  \
+                / sizeof(const FComponent*),                          \
+    }
+
 extern void f_system_run(const FSystem* System);
 extern void f_system_runEx(const FSystem* System, FCallSystemSort* SortCompare);
+extern void f_system_runParallel(const FSystem* const* Systems, unsigned NumSystems);
 
 #endif // F_INC_ECS_SYSTEM_P_H
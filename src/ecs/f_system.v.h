@@ -20,9 +20,24 @@
 
 #include "f_system.p.h"
 
+typedef struct {
+    F__EcsBitfield componentBits; // the exact component signature
+    FList* systemsActive; // FList<const FSystem*> matching active-only systems
+    FList* systemsRest; // FList<const FSystem*> other matching systems
+} FSystemMatch;
+
 extern const FSystem* const f_system__array[];
 
+extern bool f_system__parallelInProgress;
+
 extern void f_system__init(void);
 extern void f_system__uninit(void);
 
+extern const FSystemMatch* f_system__matchGet(const F__EcsBitfield ComponentBits);
+
+#if F_CONFIG_ECS_STORAGE == F_ECS_STORAGE_POOL
+    extern void f_system__entityAdd(const FSystem* System, FEntity* Entity);
+    extern void f_system__entityRemove(const FSystem* System, FEntity* Entity);
+#endif
+
 #endif // F_INC_ECS_SYSTEM_V_H
@@ -34,6 +34,7 @@ F_EXTERN_C_START
 #include "data/f_hash.p.h"
 #include "data/f_list.p.h"
 #include "data/f_listintr.p.h"
+#include "ecs/f_archetype.p.h"
 #include "ecs/f_collection.p.h"
 #include "ecs/f_component.p.h"
 #include "ecs/f_ecs.p.h"
@@ -52,10 +53,12 @@ F_EXTERN_C_START
 #include "general/f_out.p.h"
 #include "general/f_state.p.h"
 #include "graphics/f_align.p.h"
+#include "graphics/f_atlas.p.h"
 #include "graphics/f_color.p.h"
 #include "graphics/f_draw.p.h"
 #include "graphics/f_fade.p.h"
 #include "graphics/f_font.p.h"
+#include "graphics/f_particles.p.h"
 #include "graphics/f_screen.p.h"
 #include "graphics/f_screenshot.p.h"
 #include "graphics/f_sprite.p.h"
@@ -70,6 +73,7 @@ F_EXTERN_C_START
 #include "math/f_math.p.h"
 #include "math/f_random.p.h"
 #include "math/f_vec.p.h"
+#include "memory/f_arena.p.h"
 #include "memory/f_mem.p.h"
 #include "memory/f_pool.p.h"
 #include "platform/video/f_gamebuino_video.p.h"
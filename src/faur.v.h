@@ -24,6 +24,7 @@ F_EXTERN_C_START
 #include "data/f_block.v.h"
 #include "data/f_hash.v.h"
 #include "data/f_list.v.h"
+#include "ecs/f_archetype.v.h"
 #include "ecs/f_collection.v.h"
 #include "ecs/f_component.v.h"
 #include "ecs/f_ecs.v.h"
@@ -41,9 +42,11 @@ F_EXTERN_C_START
 #include "general/f_out.v.h"
 #include "general/f_state.v.h"
 #include "graphics/f_align.v.h"
+#include "graphics/f_atlas.v.h"
 #include "graphics/f_color.v.h"
 #include "graphics/f_fade.v.h"
 #include "graphics/f_font.v.h"
+#include "graphics/f_particles.v.h"
 #include "graphics/f_pixels.v.h"
 #include "graphics/f_screenshot.v.h"
 #include "graphics/f_screen.v.h"
@@ -53,9 +56,12 @@ F_EXTERN_C_START
 #include "input/f_input.v.h"
 #include "math/f_fix.v.h"
 #include "math/f_random.v.h"
+#include "memory/f_arena.v.h"
 #include "memory/f_mem.v.h"
 #include "memory/f_pool.v.h"
 #include "platform/f_platform.v.h"
+#include "platform/graphics/f_sdl_blit.v.h"
+#include "platform/graphics/f_software_bands.v.h"
 #include "platform/graphics/f_software_blit.v.h"
 #include "platform/images/f_png_image.v.h"
 #include "platform/input/f_odroid_go_input.v.h"
@@ -64,17 +64,13 @@ FPath* f_path_newf(const char* Format, ...)
         F__FATAL("f_path_newf(%s): vsnprintf failed", Format);
     }
 
-    char* buffer = f_mem_malloc((size_t)bytesNeeded);
+    char* buffer = f_arena_frameAlloc((size_t)bytesNeeded);
 
     va_start(args, Format);
     vsnprintf(buffer, (size_t)bytesNeeded, Format, args);
     va_end(args);
 
-    FPath* p = f_path_new(buffer);
-
-    f_mem_free(buffer);
-
-    return p;
+    return f_path_new(buffer);
 }
 
 void f_path_free(FPath* Path)
@@ -244,6 +244,18 @@ void f_console__draw(void)
         #if F_CONFIG_DEBUG
             printBytes(f_mem__tally, "now");
             printBytes(f_mem__top, "top");
+
+            FPoolStats pools = f_pool__statsGetTotal();
+
+            f_font_printf("Pools %u/%u peak\n", pools.numLive, pools.numPeak);
+            f_font_printf("%u objs, %u slabs\n",
+                          pools.numEntries,
+                          pools.numSlabs);
+
+            #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
+                f_font_printf(
+                    "%u SDL textures\n", f_platform_sdl_blit__sidesNum);
+            #endif
         #endif
 
         #if F_CONFIG_ECS
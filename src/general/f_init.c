@@ -24,12 +24,14 @@ bool f_init__done;
 
 static const FPack* g_packs[] = {
     &f_pack__pool,
+    &f_pack__arena,
 #if F_CONFIG_TRAIT_CONSOLE
     &f_pack__console_0,
 #endif
     &f_pack__embed,
     &f_pack__platform,
     &f_pack__screen,
+    &f_pack__atlas,
     &f_pack__align,
     &f_pack__color,
     &f_pack__font,
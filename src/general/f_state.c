@@ -39,7 +39,7 @@ static const char* g_stageNames[F__STATE_STAGE_NUM] = {
 
 static void pending_push(FCallState* Handler, const char* Name)
 {
-    FStateEntry* e = f_pool__alloc(F_POOL__STACK_STATE);
+    FStateEntry* e = f_pool__allocRaw(F_POOL__STACK_STATE);
 
     e->name = Name;
     e->handler = Handler;
@@ -49,7 +49,7 @@ static void pending_push(FCallState* Handler, const char* Name)
 
 static void pending_pop(void)
 {
-    f_listintr_addLast(&g_pending, f_pool__alloc(F_POOL__STACK_STATE));
+    pending_push(NULL, NULL);
 }
 
 static void pending_handle(void)
@@ -384,6 +384,7 @@ bool f_state__runStep(void)
         f_screen__draw();
 
         f_fps__frame();
+        f_arena__frameReset();
     } else {
         #if F_CONFIG_DEBUG
             f_out__state("'%s' running %s", s->name, g_stageNames[s->stage]);
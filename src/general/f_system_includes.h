@@ -42,6 +42,7 @@
 
 #define F__ATTRIBUTE_ALIGN(AlignExp) __attribute__((aligned (1 << (AlignExp))))
 #define F__ATTRIBUTE_NORETURN __attribute__((noreturn))
+#define F__ATTRIBUTE_THREAD __thread
 #define F__ATTRIBUTE_FORMAT(FormatIndex) \
     __attribute__((format (F_CONFIG_BUILD_ATTRIBUTE_FORMAT_PRINTF, \
                            FormatIndex, \
@@ -0,0 +1,307 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_atlas.v.h"
+#include <faur.v.h>
+
+// Page size of the shared atlas that holds embedded sprites
+#if F_CONFIG_TRAIT_LOW_MEM
+    #define F__EMBEDDED_PAGE_SIZE 256
+#else
+    #define F__EMBEDDED_PAGE_SIZE 1024
+#endif
+
+struct FAtlas {
+    FVecInt pageSize;
+    FList* pages; // FList<FAtlasPage*>
+};
+
+struct FAtlasPage {
+    FPixels pixels;
+    unsigned spritesNum; // Live sprites placed on this page
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        unsigned used; // Pixels handed out from the start of the buffer
+    #else
+        int* skyline; // [pageSize.x] First free row in each column
+        FPlatformTexture* texture;
+    #endif
+};
+
+static FAtlas* g_embedded;
+
+static void f_atlas__uninit(void)
+{
+    if(g_embedded == NULL) {
+        return;
+    }
+
+    // Embedded sprites are never freed, so their pages are always in use
+    F_LIST_ITERATE(g_embedded->pages, FAtlasPage*, p) {
+        p->spritesNum = 0;
+    }
+
+    f_atlas_free(g_embedded);
+}
+
+const FPack f_pack__atlas = {
+    "Atlas",
+    NULL,
+    f_atlas__uninit,
+};
+
+FAtlas* f_atlas_new(int PageWidth, int PageHeight)
+{
+    F__CHECK(PageWidth > 0);
+    F__CHECK(PageHeight > 0);
+
+    FAtlas* a = f_mem_malloc(sizeof(FAtlas));
+
+    a->pageSize = (FVecInt){PageWidth, PageHeight};
+    a->pages = f_list_new();
+
+    return a;
+}
+
+static void pageFree(FAtlasPage* Page)
+{
+    if(Page->spritesNum > 0) {
+        F__FATAL("f_atlas_free: %u sprites still on page", Page->spritesNum);
+    }
+
+    #if F_CONFIG_SCREEN_RENDER != F_SCREEN_RENDER_SOFTWARE
+        f_platform_api__textureFree(Page->texture);
+        f_mem_free(Page->skyline);
+    #endif
+
+    f_pixels__free(&Page->pixels);
+    f_mem_free(Page);
+}
+
+void f_atlas_free(FAtlas* Atlas)
+{
+    if(Atlas == NULL) {
+        return;
+    }
+
+    f_list_freeEx(Atlas->pages, (FCallFree*)pageFree);
+
+    f_mem_free(Atlas);
+}
+
+static FAtlasPage* pageNew(FAtlas* Atlas)
+{
+    FAtlasPage* p = f_mem_mallocz(sizeof(FAtlasPage));
+
+    f_pixels__init(&p->pixels,
+                   Atlas->pageSize.x,
+                   Atlas->pageSize.y,
+                   1,
+                   F_PIXELS__ALLOC);
+
+    #if F_CONFIG_SCREEN_RENDER != F_SCREEN_RENDER_SOFTWARE
+        p->skyline = f_mem_mallocz((size_t)Atlas->pageSize.x * sizeof(int));
+        p->texture = f_platform_api__texturePageNew(&p->pixels);
+    #endif
+
+    f_list_addLast(Atlas->pages, p);
+
+    return p;
+}
+
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+// S/W blitters read sprites as one run of frames, so pages are bump buffers
+static FAtlasPage* pageAlloc(FAtlas* Atlas, unsigned Len, FColorPixel** Buffer)
+{
+    if(Len > (unsigned)(Atlas->pageSize.x * Atlas->pageSize.y)) {
+        return NULL;
+    }
+
+    FAtlasPage* page = NULL;
+
+    F_LIST_ITERATE(Atlas->pages, FAtlasPage*, p) {
+        if(p->pixels.bufferLen - p->used >= Len) {
+            page = p;
+            break;
+        }
+    }
+
+    if(page == NULL) {
+        page = pageNew(Atlas);
+    }
+
+    *Buffer = page->pixels.u.buffer + page->used;
+    page->used += Len;
+
+    return page;
+}
+#else // F_CONFIG_SCREEN_RENDER != F_SCREEN_RENDER_SOFTWARE
+// Skyline packer, places the area at the lowest then leftmost free spot
+static bool skylineFind(const FAtlasPage* Page, FVecInt Size, FVecInt* Start)
+{
+    int bestX = -1;
+    int bestY = Page->pixels.size.y - Size.y + 1;
+
+    for(int x = 0; x + Size.x <= Page->pixels.size.x; x++) {
+        int y = 0;
+
+        for(int i = x; i < x + Size.x && y < bestY; i++) {
+            y = f_math_max(y, Page->skyline[i]);
+        }
+
+        if(y < bestY) {
+            bestX = x;
+            bestY = y;
+        }
+    }
+
+    if(bestX < 0) {
+        return false;
+    }
+
+    for(int i = bestX; i < bestX + Size.x; i++) {
+        Page->skyline[i] = bestY + Size.y;
+    }
+
+    *Start = (FVecInt){bestX, bestY};
+
+    return true;
+}
+
+static FAtlasPage* pageAlloc(FAtlas* Atlas, FVecInt Size, FVecInt* Start)
+{
+    if(Size.x > Atlas->pageSize.x || Size.y > Atlas->pageSize.y) {
+        return NULL;
+    }
+
+    F_LIST_ITERATE(Atlas->pages, FAtlasPage*, p) {
+        if(skylineFind(p, Size, Start)) {
+            return p;
+        }
+    }
+
+    FAtlasPage* page = pageNew(Atlas);
+
+    skylineFind(page, Size, Start);
+
+    return page;
+}
+
+// Frames are stacked on the page the same way as in a sprite's own texture
+static FPlatformTexture* pageTextureNew(FAtlasPage* Page, const FPixels* Pixels, FVecInt Start)
+{
+    FColorPixel* dst = f_pixels__bufferGetFrom(&Page->pixels, 0, Start.x, Start.y);
+    const FColorPixel* src = f_pixels__bufferGetStartConst(Pixels, 0);
+
+    for(int i = Pixels->size.y * (int)Pixels->framesNum; i--; ) {
+        memcpy(dst, src, (unsigned)Pixels->size.x * sizeof(FColorPixel));
+
+        src += Pixels->size.x;
+        dst += Page->pixels.size.x;
+    }
+
+    return f_platform_api__texturePageSub(
+            Page->texture,
+            Start.x,
+            Start.y,
+            Pixels->size.x,
+            Pixels->size.y * (int)Pixels->framesNum);
+}
+
+FPlatformTexture* f_atlas__textureNewEmbedded(const FPixels* Pixels)
+{
+    if(g_embedded == NULL) {
+        g_embedded = f_atlas_new(F__EMBEDDED_PAGE_SIZE, F__EMBEDDED_PAGE_SIZE);
+    }
+
+    FVecInt start;
+    FAtlasPage* page = pageAlloc(
+                        g_embedded,
+                        (FVecInt){Pixels->size.x,
+                                  Pixels->size.y * (int)Pixels->framesNum},
+                        &start);
+
+    if(page == NULL) {
+        return f_platform_api__textureNew(Pixels);
+    }
+
+    return pageTextureNew(page, Pixels, start);
+}
+#endif // F_CONFIG_SCREEN_RENDER != F_SCREEN_RENDER_SOFTWARE
+
+FSprite* f_atlas_spriteNew(FAtlas* Atlas, const FSprite* Sprite)
+{
+    F__CHECK(Atlas != NULL);
+    F__CHECK(Sprite != NULL);
+
+    // Pages hold native pixels, indexed sprites keep their own
+    if(f_pixels__isIndexed(&Sprite->pixels)) {
+        return f_sprite_dup(Sprite);
+    }
+
+    const FPixels* pixels = &Sprite->pixels;
+    FSprite* s = f_pool__alloc(F_POOL__SPRITE);
+
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        FColorPixel* buffer;
+        FAtlasPage* page = pageAlloc(
+                            Atlas, pixels->bufferLen * pixels->framesNum, &buffer);
+
+        if(page == NULL) {
+            f_pixels__copy(&s->pixels, pixels);
+            s->u.texture = f_platform_api__textureNew(&s->pixels);
+
+            return s;
+        }
+
+        memcpy(buffer,
+               f_pixels__bufferGetStartConst(pixels, 0),
+               pixels->bufferSize * pixels->framesNum);
+
+        // The page owns the buffer
+        s->pixels = *pixels;
+        s->pixels.flags = F_PIXELS__CONST;
+        s->pixels.u.buffer = buffer;
+        s->u.texture = f_platform_api__textureNew(&s->pixels);
+    #else
+        f_pixels__copy(&s->pixels, pixels);
+
+        FVecInt start;
+        FAtlasPage* page = pageAlloc(
+                            Atlas,
+                            (FVecInt){pixels->size.x,
+                                      pixels->size.y * (int)pixels->framesNum},
+                            &start);
+
+        if(page == NULL) {
+            s->u.texture = f_platform_api__textureNew(&s->pixels);
+
+            return s;
+        }
+
+        s->u.texture = pageTextureNew(page, &s->pixels, start);
+    #endif
+
+    page->spritesNum++;
+    s->atlasPage = page;
+
+    return s;
+}
+
+void f_atlas__pageRelease(FAtlasPage* Page)
+{
+    Page->spritesNum--;
+}
@@ -20,7 +20,7 @@
 
 #include <faur_v/faur_gfx/f_palette.png.h>
 
-FColorState f__color;
+F__RENDER_LOCAL FColorState f__color;
 
 FColorPixel f_color__key;
 FColorPixel f_color__limit;
@@ -43,6 +43,19 @@ typedef struct FColorState FColorState;
     (F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE \
         && F_CONFIG_TRAIT_SLOW_MUL)
 
+// Software draws are replayed on worker threads, one screen band per item
+#define F__RENDER_BANDS \
+    (F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE \
+        && F_CONFIG_SCREEN_RENDER_THREADS \
+        && F_CONFIG_LIB_PTHREAD)
+
+// Each band thread has its own copy of the color and screen target state
+#if F__RENDER_BANDS
+    #define F__RENDER_LOCAL F__ATTRIBUTE_THREAD
+#else
+    #define F__RENDER_LOCAL
+#endif
+
 struct FColorState {
     FListIntrNode listNode;
     const FPalette* palette;
@@ -59,7 +72,7 @@ struct FColorState {
 
 extern const FPack f_pack__color;
 
-extern FColorState f__color;
+extern F__RENDER_LOCAL FColorState f__color;
 
 extern FColorPixel f_color__key;
 extern FColorPixel f_color__limit;
@@ -31,11 +31,25 @@ void f_draw_pixel(int X, int Y)
     f_platform_api__drawPixel(X, Y);
 }
 
+void f_draw_pixels(const FVecInt* Points, unsigned Num)
+{
+    F__CHECK(Points != NULL || Num == 0);
+
+    f_platform_api__drawPixels(Points, Num);
+}
+
 void f_draw_line(int X1, int Y1, int X2, int Y2)
 {
     f_platform_api__drawLine(X1, Y1, X2, Y2);
 }
 
+void f_draw_lines(const FVecInt* Points, unsigned Num)
+{
+    F__CHECK(Points != NULL || Num == 0);
+
+    f_platform_api__drawLines(Points, Num);
+}
+
 void f_draw_lineh(int X1, int X2, int Y)
 {
     f_platform_api__drawLineH(f_math_min(X1, X2), f_math_max(X1, X2), Y);
@@ -58,6 +72,22 @@ void f_draw_rectangle(int X, int Y, int Width, int Height)
     }
 }
 
+void f_draw_rectangles(const FVecInt* Rects, unsigned Num)
+{
+    F__CHECK(Rects != NULL || Num == 0);
+
+    for(unsigned i = 0; i < Num; i++) {
+        F__CHECK(Rects[2 * i + 1].x >= 0);
+        F__CHECK(Rects[2 * i + 1].y >= 0);
+    }
+
+    if(f__color.fillDraw) {
+        f_platform_api__drawRectanglesFilled(Rects, Num);
+    } else {
+        f_platform_api__drawRectanglesOutline(Rects, Num);
+    }
+}
+
 void f_draw_circle(int X, int Y, int Radius)
 {
     F__CHECK(Radius >= 0);
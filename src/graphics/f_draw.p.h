@@ -20,12 +20,17 @@
 
 #include "../general/f_system_includes.h"
 
+#include "../math/f_vec.p.h"
+
 extern void f_draw_fill(void);
 extern void f_draw_pixel(int X, int Y);
+extern void f_draw_pixels(const FVecInt* Points, unsigned Num);
 extern void f_draw_line(int X1, int Y1, int X2, int Y2);
+extern void f_draw_lines(const FVecInt* Points, unsigned Num);
 extern void f_draw_lineh(int X1, int X2, int Y);
 extern void f_draw_linev(int X, int Y1, int Y2);
 extern void f_draw_rectangle(int X, int Y, int Width, int Height);
+extern void f_draw_rectangles(const FVecInt* Rects, unsigned Num);
 extern void f_draw_circle(int X, int Y, int Radius);
 
 #endif // F_INC_GRAPHICS_DRAW_P_H
@@ -25,6 +25,12 @@
 #define F__CHAR_INDEX(Char) ((unsigned)Char - F__CHAR_START)
 #define F__LINE_SPACING 1
 
+// Lay out strings once and blit them as a single pre-rendered run, only with
+// the software renderer since runs are drawn into their CPU-side pixels
+#define F__TEXT_CACHE \
+    (F_CONFIG_FONT_CACHE > 0 \
+        && F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE)
+
 static const FFont* const g_defaultFonts[F_FONT__ID_NUM] = {
     [F_FONT__ID_BLOCK] = &FSprite__f_font_6x8,
     #if !F_CONFIG_TRAIT_LOW_MEM
@@ -36,14 +42,103 @@ static FFontState g_state;
 static F_LISTINTR(g_stack, FFontState, listNode);
 static char g_buffer[512];
 
+#if F__TEXT_CACHE
+typedef struct {
+    const FFont* font;
+    const char* text;
+    int x; // relative to startX, where wrapped lines go back to
+    int lineWidth, lineHeight, wrapWidth;
+    FAlign align;
+} FTextKey;
+
+typedef struct {
+    FListIntrNode listNode;
+    FTextKey key;
+    FSprite* run; // NULL if there is nothing to draw
+    FVecInt runOffset; // run's top-left, relative to (startX, y)
+    FVecInt end; // coords after printing, relative to (startX, y)
+    int endLineWidth;
+} FTextEntry;
+
+static struct {
+    FHash* entries; // FHash<const FTextKey*, FTextEntry*>
+    unsigned num;
+    unsigned hits, misses;
+    unsigned seen[F_CONFIG_FONT_CACHE]; // hashes of strings printed once
+    bool measure; // drawString grows the box instead of drawing
+    FVecInt boxStart, boxEnd;
+} g_cache;
+
+static F_LISTINTR(g_lru, FTextEntry, listNode); // most recently used first
+
+static unsigned textHash(const FTextKey* Key)
+{
+    unsigned h = 5381;
+
+    for(const char* t = Key->text; *t != '\0'; t++) {
+        h += (h << 5) + (unsigned)*t;
+    }
+
+    h += (h << 5) + (unsigned)((uintptr_t)Key->font >> 4);
+    h += (h << 5) + (unsigned)Key->x;
+    h += (h << 5) + (unsigned)Key->lineWidth;
+    h += (h << 5) + (unsigned)Key->wrapWidth;
+
+    return h;
+}
+
+static bool textEqual(const FTextKey* KeyA, const FTextKey* KeyB)
+{
+    return KeyA->font == KeyB->font
+        && KeyA->x == KeyB->x
+        && KeyA->lineWidth == KeyB->lineWidth
+        && KeyA->lineHeight == KeyB->lineHeight
+        && KeyA->wrapWidth == KeyB->wrapWidth
+        && KeyA->align.x == KeyB->align.x
+        && KeyA->align.y == KeyB->align.y
+        && f_str_equal(KeyA->text, KeyB->text);
+}
+
+static void textEntryFree(FTextEntry* Entry)
+{
+    f_hash_removeKey(g_cache.entries, &Entry->key);
+    f_listintr_removeNode(&Entry->listNode);
+
+    f_sprite_free(Entry->run);
+    f_mem_free((char*)Entry->key.text);
+    f_mem_free(Entry);
+
+    g_cache.num--;
+}
+#endif
+
 static void f_font__init(void)
 {
     f_font_reset();
+
+    #if F__TEXT_CACHE
+        g_cache.entries = f_hash_new((FCallHashFunction*)textHash,
+                                     (FCallHashEqual*)textEqual,
+                                     NULL,
+                                     F_CONFIG_FONT_CACHE);
+    #endif
 }
 
 static void f_font__uninit(void)
 {
     f_listintr_apply(&g_stack, f_pool_release);
+
+    #if F__TEXT_CACHE
+        f_out__info("Text cache: %u hits, %u misses",
+                    g_cache.hits,
+                    g_cache.misses);
+
+        while(!f_listintr_sizeIsEmpty(&g_lru)) {
+            textEntryFree(f_listintr_getFirst(&g_lru));
+        }
+
+        f_hash_free(g_cache.entries);
+    #endif
 }
 
 const FPack f_pack__font = {
@@ -78,6 +173,14 @@ void f_font_free(FFont* Font)
         return;
     }
 
+    #if F__TEXT_CACHE
+        F_LISTINTR_ITERATE(&g_lru, FTextEntry*, e) {
+            if(e->key.font == Font) {
+                textEntryFree(e);
+            }
+        }
+    #endif
+
     f_sprite_free(Font);
 }
 
@@ -191,6 +294,22 @@ static void drawString(const char* Text, ptrdiff_t Length)
         y -= f_sprite_sizeGetHeight(chars);
     }
 
+    #if F__TEXT_CACHE
+        if(g_cache.measure) {
+            if(Length > 0) {
+                g_cache.boxStart.x = f_math_min(g_cache.boxStart.x, x);
+                g_cache.boxStart.y = f_math_min(g_cache.boxStart.y, y);
+                g_cache.boxEnd.x = f_math_max(
+                    g_cache.boxEnd.x, x + (int)Length * charWidth);
+                g_cache.boxEnd.y = f_math_max(
+                    g_cache.boxEnd.y, y + f_sprite_sizeGetHeight(chars));
+            }
+
+            x += (int)Length * charWidth;
+            Length = 0;
+        }
+    #endif
+
     for( ; Length--; Text++) {
         f_sprite_blit(chars, F__CHAR_INDEX(*Text), x, y);
         x += charWidth;
@@ -261,10 +380,8 @@ static void wrapString(const char* Text)
     drawString(lineStart, Text - lineStart);
 }
 
-void f_font_print(const char* Text)
+static void printText(const char* Text)
 {
-    F__CHECK(Text != NULL);
-
     if(g_state.wrapWidth > 0) {
         wrapString(Text);
 
@@ -288,6 +405,139 @@ void f_font_print(const char* Text)
     drawString(lineStart, Text - lineStart);
 }
 
+#if F__TEXT_CACHE
+static void textRender(FTextEntry* Entry)
+{
+    FFontState state = g_state;
+
+    // Lay out relative to (startX, y)
+    g_state.x -= g_state.startX;
+    g_state.startX = 0;
+    g_state.y = 0;
+
+    g_cache.measure = true;
+    g_cache.boxStart = (FVecInt){INT_MAX, INT_MAX};
+    g_cache.boxEnd = (FVecInt){INT_MIN, INT_MIN};
+
+    printText(Entry->key.text);
+
+    g_cache.measure = false;
+
+    Entry->end = (FVecInt){g_state.x, g_state.y};
+    Entry->endLineWidth = g_state.currentLineWidth;
+
+    if(g_cache.boxStart.x < g_cache.boxEnd.x) {
+        Entry->runOffset = g_cache.boxStart;
+        Entry->run = f_sprite_newBlank(g_cache.boxEnd.x - g_cache.boxStart.x,
+                                       g_cache.boxEnd.y - g_cache.boxStart.y,
+                                       1,
+                                       true);
+
+        // Draw again from the start, shifted onto the run
+        g_state = state;
+        g_state.x -= g_state.startX + Entry->runOffset.x;
+        g_state.startX = -Entry->runOffset.x;
+        g_state.y = -Entry->runOffset.y;
+
+        f_screen_push(Entry->run, 0);
+        f_color_push();
+
+        printText(Entry->key.text);
+
+        f_color_pop();
+        f_screen_pop();
+    }
+
+    g_state = state;
+}
+
+// Returns false if Text is not cached and should be drawn directly
+static bool textCached(const char* Text)
+{
+    // Overlapping lines would blend differently when drawn as one run
+    if(g_state.lineHeight < f_sprite_sizeGetHeight(g_state.font)) {
+        return false;
+    }
+
+    const FTextKey key = {
+        .font = g_state.font,
+        .text = Text,
+        .x = g_state.x - g_state.startX,
+        .lineWidth = g_state.currentLineWidth,
+        .lineHeight = g_state.lineHeight,
+        .wrapWidth = g_state.wrapWidth,
+        .align = f__align,
+    };
+
+    FTextEntry* e = f_hash_get(g_cache.entries, &key);
+
+    if(e == NULL) {
+        g_cache.misses++;
+
+        // Only cache strings printed before, so text that changes every
+        // frame does not allocate or evict anything
+        unsigned hash = textHash(&key);
+        unsigned* seen = &g_cache.seen[hash % F_CONFIG_FONT_CACHE];
+
+        if(*seen != hash) {
+            *seen = hash;
+
+            return false;
+        }
+
+        if(g_cache.num == F_CONFIG_FONT_CACHE) {
+            textEntryFree(f_listintr_getLast(&g_lru));
+        }
+
+        e = f_mem_mallocz(sizeof(FTextEntry));
+
+        e->key = key;
+        e->key.text = f_str_dup(Text);
+
+        f_hash_add(g_cache.entries, &e->key, e);
+        f_listintr_addFirst(&g_lru, e);
+        g_cache.num++;
+
+        textRender(e);
+    } else {
+        g_cache.hits++;
+
+        f_listintr_removeNode(&e->listNode);
+        f_listintr_addFirst(&g_lru, e);
+    }
+
+    if(e->run) {
+        FAlign align = f__align;
+
+        f_align_set(F_ALIGN_X_LEFT, F_ALIGN_Y_TOP);
+        f_sprite_blit(e->run,
+                      0,
+                      g_state.startX + e->runOffset.x,
+                      g_state.y + e->runOffset.y);
+        f__align = align;
+    }
+
+    g_state.x = g_state.startX + e->end.x;
+    g_state.y += e->end.y;
+    g_state.currentLineWidth = e->endLineWidth;
+
+    return true;
+}
+#endif
+
+void f_font_print(const char* Text)
+{
+    F__CHECK(Text != NULL);
+
+    #if F__TEXT_CACHE
+        if(textCached(Text)) {
+            return;
+        }
+    #endif
+
+    printText(Text);
+}
+
 void f_font_printf(const char* Format, ...)
 {
     F__CHECK(Format != NULL);
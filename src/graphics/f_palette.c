@@ -85,6 +85,7 @@ FPalette* f_palette_newFromFile(const char* Path)
 FPalette* f_palette_newFromSprite(const FSprite* Sprite)
 {
     F__CHECK(Sprite != NULL);
+    F__CHECK(!f_pixels__isIndexed(&Sprite->pixels));
 
     return newPalette(&Sprite->pixels);
 }
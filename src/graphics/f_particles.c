@@ -0,0 +1,202 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_particles.v.h"
+#include <faur.v.h>
+
+// Points converted per f_draw_pixels call
+#define F__DRAW_BATCH 256
+
+FParticles* f_particles_new(unsigned Capacity)
+{
+    F__CHECK(Capacity > 0);
+
+    FParticles* p = f_mem_mallocz(sizeof(FParticles));
+
+    // One buffer for all the arrays, so particles never allocate
+    p->x = f_mem_malloc(Capacity * (4 * sizeof(FFix) + sizeof(unsigned)));
+    p->y = p->x + Capacity;
+    p->vx = p->y + Capacity;
+    p->vy = p->vx + Capacity;
+    p->life = (unsigned*)(p->vy + Capacity);
+    p->capacity = Capacity;
+
+    return p;
+}
+
+void f_particles_free(FParticles* Particles)
+{
+    if(Particles == NULL) {
+        return;
+    }
+
+    f_mem_free(Particles->x);
+    f_mem_free(Particles);
+}
+
+void f_particles_clear(FParticles* Particles)
+{
+    F__CHECK(Particles != NULL);
+
+    Particles->num = 0;
+}
+
+unsigned f_particles_numGet(const FParticles* Particles)
+{
+    F__CHECK(Particles != NULL);
+
+    return Particles->num;
+}
+
+void f_particles_gravitySet(FParticles* Particles, FVecFix Gravity)
+{
+    F__CHECK(Particles != NULL);
+
+    Particles->gravity = Gravity;
+}
+
+bool f_particles_add(FParticles* Particles, FVecFix Position, FVecFix Velocity, unsigned Life)
+{
+    F__CHECK(Particles != NULL);
+
+    if(Particles->num == Particles->capacity || Life == 0) {
+        return false;
+    }
+
+    unsigned i = Particles->num++;
+
+    Particles->x[i] = Position.x;
+    Particles->y[i] = Position.y;
+    Particles->vx[i] = Velocity.x;
+    Particles->vy[i] = Velocity.y;
+    Particles->life[i] = Life;
+
+    return true;
+}
+
+// Returns [0, Max], built from two 15-bit draws since rand() may not give more
+static inline unsigned randomUpTo(unsigned Max)
+{
+    unsigned r = (f_random_intu(1u << 15) << 15) | f_random_intu(1u << 15);
+
+    return (unsigned)((((uint64_t)Max + 1) * r) >> 30);
+}
+
+static inline FFix spread(FFix Value, FFix Range)
+{
+    if(Range <= 0) {
+        return Value;
+    }
+
+    return Value + (FFix)((int64_t)randomUpTo((unsigned)Range * 2) - Range);
+}
+
+unsigned f_particles_emit(FParticles* Particles, const FParticlesEmitter* Emitter, unsigned Num)
+{
+    F__CHECK(Particles != NULL);
+    F__CHECK(Emitter != NULL);
+
+    Num = f_math_minu(Num, Particles->capacity - Particles->num);
+
+    for(unsigned n = Num; n--; ) {
+        unsigned i = Particles->num++;
+        unsigned life = Emitter->life;
+
+        if(Emitter->lifeRange > 0) {
+            life += randomUpTo(Emitter->lifeRange);
+        }
+
+        Particles->x[i] = spread(Emitter->position.x, Emitter->positionRange.x);
+        Particles->y[i] = spread(Emitter->position.y, Emitter->positionRange.y);
+        Particles->vx[i] = spread(Emitter->velocity.x, Emitter->velocityRange.x);
+        Particles->vy[i] = spread(Emitter->velocity.y, Emitter->velocityRange.y);
+        Particles->life[i] = f_math_maxu(life, 1);
+    }
+
+    return Num;
+}
+
+void f_particles_tick(FParticles* Particles)
+{
+    F__CHECK(Particles != NULL);
+
+    FFix* x = Particles->x;
+    FFix* y = Particles->y;
+    FFix* vx = Particles->vx;
+    FFix* vy = Particles->vy;
+    unsigned* life = Particles->life;
+    const FFix gx = Particles->gravity.x;
+    const FFix gy = Particles->gravity.y;
+    unsigned num = Particles->num;
+
+    // Branch-free pass the compiler can vectorize
+    for(unsigned i = 0; i < num; i++) {
+        vx[i] += gx;
+        vy[i] += gy;
+        x[i] += vx[i];
+        y[i] += vy[i];
+        life[i]--;
+    }
+
+    // Expired particles are replaced by the last live one
+    for(unsigned i = 0; i < num; ) {
+        if(life[i] > 0) {
+            i++;
+
+            continue;
+        }
+
+        num--;
+
+        x[i] = x[num];
+        y[i] = y[num];
+        vx[i] = vx[num];
+        vy[i] = vy[num];
+        life[i] = life[num];
+    }
+
+    Particles->num = num;
+}
+
+void f_particles_draw(const FParticles* Particles, const FSprite* Sprite, unsigned Frame)
+{
+    F__CHECK(Particles != NULL);
+
+    const FFix* x = Particles->x;
+    const FFix* y = Particles->y;
+
+    if(Sprite != NULL) {
+        for(unsigned i = 0; i < Particles->num; i++) {
+            f_sprite_blit(Sprite, Frame, f_fix_toInt(x[i]), f_fix_toInt(y[i]));
+        }
+
+        return;
+    }
+
+    FVecInt points[F__DRAW_BATCH];
+
+    for(unsigned i = 0; i < Particles->num; ) {
+        unsigned n = f_math_minu(Particles->num - i, F__DRAW_BATCH);
+
+        for(unsigned j = 0; j < n; j++, i++) {
+            points[j].x = f_fix_toInt(x[i]);
+            points[j].y = f_fix_toInt(y[i]);
+        }
+
+        f_draw_pixels(points, n);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_GRAPHICS_PARTICLES_P_H
+#define F_INC_GRAPHICS_PARTICLES_P_H
+
+#include "../general/f_system_includes.h"
+
+typedef struct FParticles FParticles;
+typedef struct FParticlesEmitter FParticlesEmitter;
+
+#include "../graphics/f_sprite.p.h"
+#include "../math/f_vec.p.h"
+
+struct FParticlesEmitter {
+    FVecFix position, positionRange; // spawn at position +/- range
+    FVecFix velocity, velocityRange; // start at velocity +/- range
+    unsigned life, lifeRange; // live for life + [0, range] ticks
+};
+
+extern FParticles* f_particles_new(unsigned Capacity);
+extern void f_particles_free(FParticles* Particles);
+
+extern void f_particles_clear(FParticles* Particles);
+extern unsigned f_particles_numGet(const FParticles* Particles);
+extern void f_particles_gravitySet(FParticles* Particles, FVecFix Gravity);
+
+extern bool f_particles_add(FParticles* Particles, FVecFix Position, FVecFix Velocity, unsigned Life);
+extern unsigned f_particles_emit(FParticles* Particles, const FParticlesEmitter* Emitter, unsigned Num);
+
+extern void f_particles_tick(FParticles* Particles);
+extern void f_particles_draw(const FParticles* Particles, const FSprite* Sprite, unsigned Frame);
+
+#endif // F_INC_GRAPHICS_PARTICLES_P_H
@@ -18,6 +18,8 @@
 #include "f_pixels.v.h"
 #include <faur.v.h>
 
+#include "f_pixels_vec.v.h"
+
 FPixels* f_pixels__new(int W, int H, unsigned Frames, unsigned Flags)
 {
     if(W <= 0 || H <= 0 || Frames == 0) {
@@ -41,10 +43,21 @@ void f_pixels__init(FPixels* Pixels, int W, int H, unsigned Frames, unsigned Fla
     Pixels->size.y = H;
     Pixels->framesNum = Frames;
     Pixels->flags = Flags;
+    Pixels->lut = NULL;
 
     if(F_FLAGS_TEST_ANY(Flags, F_PIXELS__ALLOC)) {
         Pixels->bufferLen = (unsigned)(W * H);
-        Pixels->bufferSize = Pixels->bufferLen * (unsigned)sizeof(FColorPixel);
+
+        if(F_FLAGS_TEST_ANY(Flags, F_PIXELS__INDEXED)) {
+            Pixels->bufferSize = Pixels->bufferLen;
+            Pixels->lut =
+                f_mem_mallocz(F_PIXELS__LUT_SIZE * sizeof(FColorPixel));
+            Pixels->lut[0] = f_color__key;
+        } else {
+            Pixels->bufferSize =
+                Pixels->bufferLen * (unsigned)sizeof(FColorPixel);
+        }
+
         Pixels->u.buffer = f_mem_mallocz(Pixels->bufferSize * Frames);
     } else {
         Pixels->bufferLen = 0;
@@ -63,6 +76,8 @@ void f_pixels__free(FPixels* Pixels)
         f_mem_free(Pixels->u.buffer);
     }
 
+    f_mem_free(Pixels->lut);
+
     if(F_FLAGS_TEST_ANY(Pixels->flags, F_PIXELS__DYNAMIC)) {
         f_mem_free(Pixels);
     }
@@ -81,6 +96,11 @@ void f_pixels__copy(FPixels* Dst, const FPixels* Src)
         Dst->u.buffer =
             f_mem_dup(Dst->u.buffer, Dst->bufferSize * Dst->framesNum);
     }
+
+    if(Dst->lut) {
+        Dst->lut = f_mem_dup(Dst->lut,
+                             F_PIXELS__LUT_SIZE * sizeof(FColorPixel));
+    }
 }
 
 void f_pixels__copyFrame(const FPixels* Dst, unsigned DstFrame, const FPixels* Src, unsigned SrcFrame)
@@ -92,15 +112,25 @@ void f_pixels__copyFrame(const FPixels* Dst, unsigned DstFrame, const FPixels* S
 
 void f_pixels__copyFrameEx(const FPixels* Dst, unsigned DstFrame, const FPixels* SrcPixels, int SrcX, int SrcY)
 {
-    FColorPixel* dst = f_pixels__bufferGetStart(Dst, DstFrame);
-    const FColorPixel* src =
-        f_pixels__bufferGetFromConst(SrcPixels, 0, SrcX, SrcY);
+    // Both indexed or both not, the element size is the same
+    const size_t pixelSize = Dst->bufferSize / Dst->bufferLen;
+    uint8_t* dst = Dst->u.indices + DstFrame * Dst->bufferSize;
+    const uint8_t* src = SrcPixels->u.indicesConst
+                            + (size_t)(SrcY * SrcPixels->size.x + SrcX)
+                                * pixelSize;
+
+    if(SrcPixels->size.x == Dst->size.x) {
+        // Full-width frames are one block, like a vertical strip sheet
+        memcpy(dst, src, Dst->bufferSize);
+
+        return;
+    }
 
     for(int i = Dst->size.y; i--; ) {
-        memcpy(dst, src, (unsigned)Dst->size.x * sizeof(FColorPixel));
+        memcpy(dst, src, (size_t)Dst->size.x * pixelSize);
 
-        src += SrcPixels->size.x;
-        dst += Dst->size.x;
+        src += (size_t)SrcPixels->size.x * pixelSize;
+        dst += (size_t)Dst->size.x * pixelSize;
     }
 }
 
@@ -117,9 +147,109 @@ void f_pixels__bufferSet(FPixels* Pixels, FColorPixel* Buffer, int W, int H)
 void f_pixels__fill(const FPixels* Pixels, unsigned Frame, FColorPixel Value)
 {
     FColorPixel* buffer = f_pixels__bufferGetStart(Pixels, Frame);
+    const int len = (int)Pixels->bufferLen;
+
+    #if F_PIXELS_VEC__SIMD
+        const FVecPixels value = f_pixels_vec__splat(Value);
+
+        for(int i = 0; i < F_PIXELS_VEC__DONE(len); i += F_PIXELS_VEC__LANES) {
+            f_pixels_vec__store(buffer + i, value);
+        }
+    #endif
+
+    for(int i = F_PIXELS_VEC__DONE(len); i < len; i++) {
+        buffer[i] = Value;
+    }
+}
+
+// Each pixel that matches one of Old takes the color at the same New index,
+// the last match wins like in the scalar loop
+void f_pixels__swap(const FPixels* Pixels, unsigned Frame, const FColorPixel* Old, const FColorPixel* New, unsigned Num)
+{
+    FColorPixel* buffer = f_pixels__bufferGetStart(Pixels, Frame);
+    const int len = (int)Pixels->bufferLen;
+
+    #if F_PIXELS_VEC__SIMD
+        for(int i = 0; i < F_PIXELS_VEC__DONE(len); i += F_PIXELS_VEC__LANES) {
+            const FVecPixels pixels = f_pixels_vec__load(buffer + i);
+            FVecPixels swapped = pixels;
+            FVecPixels done = f_pixels_vec__splat(0);
+
+            for(unsigned c = Num; c--; ) {
+                const FVecPixels match =
+                    f_pixels_vec__equal(pixels, f_pixels_vec__splat(Old[c]))
+                        & ~done;
+
+                swapped = (swapped & ~match)
+                        | (f_pixels_vec__splat(New[c]) & match);
+                done |= match;
+            }
+
+            f_pixels_vec__store(buffer + i, swapped);
+        }
+    #endif
+
+    for(int i = F_PIXELS_VEC__DONE(len); i < len; i++) {
+        const FColorPixel pixel = buffer[i];
+
+        for(unsigned c = Num; c--; ) {
+            if(pixel == Old[c]) {
+                buffer[i] = New[c];
+                break;
+            }
+        }
+    }
+}
+
+bool f_pixels__keyFind(const FPixels* Pixels, unsigned Frame)
+{
+    if(f_pixels__isIndexed(Pixels)) {
+        return memchr(f_pixels__indicesGetStartConst(Pixels, Frame),
+                      0,
+                      Pixels->bufferLen) != NULL;
+    }
+
+    const FColorPixel* buffer = f_pixels__bufferGetStartConst(Pixels, Frame);
+    const int len = (int)Pixels->bufferLen;
+
+    #if F_PIXELS_VEC__SIMD
+        const FVecPixels key = f_pixels_vec__splat(f_color__key);
+
+        for(int i = 0; i < F_PIXELS_VEC__DONE(len); i += F_PIXELS_VEC__LANES) {
+            const FVecPixels match =
+                f_pixels_vec__equal(f_pixels_vec__load(buffer + i), key);
+
+            // Reduce to one lane, any set bit means a key pixel
+            FColorPixel any = 0;
+
+            for(int l = 0; l < F_PIXELS_VEC__LANES; l++) {
+                any |= match[l];
+            }
+
+            if(any) {
+                return true;
+            }
+        }
+    #endif
+
+    for(int i = F_PIXELS_VEC__DONE(len); i < len; i++) {
+        if(buffer[i] == f_color__key) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Buffer has room for all the frames in native pixels
+void f_pixels__indexedExpand(const FPixels* Pixels, FColorPixel* Buffer)
+{
+    const uint8_t* indices = Pixels->u.indicesConst;
+    const FColorPixel* lut = Pixels->lut;
 
-    for(unsigned i = Pixels->bufferLen; i--; ) {
-        *buffer++ = Value;
+    for(unsigned i = Pixels->bufferLen * Pixels->framesNum; i--; ) {
+        *Buffer++ = *indices ? lut[*indices] : f_color__key;
+        indices++;
     }
 }
 
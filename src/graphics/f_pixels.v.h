@@ -29,6 +29,11 @@ typedef struct FPixels FPixels;
 #define F_PIXELS__ALLOC F_FLAGS_BIT(0)
 #define F_PIXELS__DYNAMIC F_FLAGS_BIT(1)
 #define F_PIXELS__CONST F_FLAGS_BIT(2)
+#define F_PIXELS__ATLAS F_FLAGS_BIT(3)
+#define F_PIXELS__INDEXED F_FLAGS_BIT(4)
+
+// Indexed pixels are 8-bit entries into the lut, index 0 is transparent
+#define F_PIXELS__LUT_SIZE 256
 
 struct FPixels {
     FVecInt size;
@@ -39,7 +44,10 @@ struct FPixels {
     union {
         FColorPixel* buffer; // [w * h * framesNum]
         const FColorPixel* bufferConst; // [w * h * framesNum]
+        uint8_t* indices; // [w * h * framesNum] if F_PIXELS__INDEXED
+        const uint8_t* indicesConst;
     } u;
+    FColorPixel* lut; // [F_PIXELS__LUT_SIZE] if F_PIXELS__INDEXED
 };
 
 extern FPixels* f_pixels__new(int W, int H, unsigned Frames, unsigned Flags);
@@ -53,6 +61,10 @@ extern void f_pixels__copyFrameEx(const FPixels* Dst, unsigned DstFrame, const F
 extern void f_pixels__bufferSet(FPixels* Pixels, FColorPixel* Buffer, int W, int H);
 
 extern void f_pixels__fill(const FPixels* Pixels, unsigned Frame, FColorPixel Value);
+extern void f_pixels__swap(const FPixels* Pixels, unsigned Frame, const FColorPixel* Old, const FColorPixel* New, unsigned Num);
+extern bool f_pixels__keyFind(const FPixels* Pixels, unsigned Frame);
+
+extern void f_pixels__indexedExpand(const FPixels* Pixels, FColorPixel* Buffer);
 
 extern FVecInt f_pixels__boundsFind(const FPixels* Pixels, int X, int Y);
 
@@ -83,4 +95,20 @@ static inline FColorPixel f_pixels__bufferGetValue(const FPixels* Pixels, unsign
     return *f_pixels__bufferGetFrom(Pixels, Frame, X, Y);
 }
 
+static inline bool f_pixels__isIndexed(const FPixels* Pixels)
+{
+    return F_FLAGS_TEST_ANY(Pixels->flags, F_PIXELS__INDEXED);
+}
+
+static inline const uint8_t* f_pixels__indicesGetStartConst(const FPixels* Pixels, unsigned Frame)
+{
+    return Pixels->u.indicesConst + Frame * Pixels->bufferLen;
+}
+
+static inline const uint8_t* f_pixels__indicesGetFromConst(const FPixels* Pixels, unsigned Frame, int X, int Y)
+{
+    return f_pixels__indicesGetStartConst(Pixels, Frame)
+            + Y * Pixels->size.x + X;
+}
+
 #endif // F_INC_GRAPHICS_PIXELS_V_H
@@ -0,0 +1,86 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_GRAPHICS_PIXELS_VEC_V_H
+#define F_INC_GRAPHICS_PIXELS_VEC_V_H
+
+#include "f_pixels_vec.p.h"
+
+#include "../graphics/f_color.v.h"
+
+// Bulk pixel loops use GCC vector extensions, which build to SSE2 or AVX2
+// on x86 and NEON on ARM depending on the target flags. Other compilers and
+// targets only get the scalar loops.
+#if !defined(__GNUC__) || (__GNUC__ < 5 && !defined(__clang__))
+    #define F_PIXELS_VEC__SIMD 0
+#elif !defined(__SSE2__) && !defined(__ARM_NEON)
+    #define F_PIXELS_VEC__SIMD 0
+#else
+    #define F_PIXELS_VEC__SIMD 1
+#endif
+
+#if F_PIXELS_VEC__SIMD
+#ifdef __AVX2__
+    #define F_PIXELS_VEC__BYTES 32
+#else
+    #define F_PIXELS_VEC__BYTES 16
+#endif
+
+#define F_PIXELS_VEC__LANES (F_PIXELS_VEC__BYTES / (int)sizeof(FColorPixel))
+
+// Vector loops cover the first F_PIXELS_VEC__DONE(Len) pixels of a run
+#define F_PIXELS_VEC__DONE(Len) ((Len) - (Len) % F_PIXELS_VEC__LANES)
+
+// One pixel per lane
+typedef FColorPixel FVecPixels
+    __attribute__((vector_size(F_PIXELS_VEC__BYTES)));
+
+static inline FVecPixels f_pixels_vec__splat(FColorPixel Value)
+{
+    FVecPixels v;
+
+    for(int i = 0; i < F_PIXELS_VEC__LANES; i++) {
+        v[i] = Value;
+    }
+
+    return v;
+}
+
+static inline FVecPixels f_pixels_vec__load(const FColorPixel* Buffer)
+{
+    FVecPixels v;
+
+    memcpy(&v, Buffer, sizeof(FVecPixels));
+
+    return v;
+}
+
+static inline void f_pixels_vec__store(FColorPixel* Buffer, FVecPixels Pixels)
+{
+    memcpy(Buffer, &Pixels, sizeof(FVecPixels));
+}
+
+// All bits set in the lanes where A and B are equal
+static inline FVecPixels f_pixels_vec__equal(FVecPixels A, FVecPixels B)
+{
+    return (FVecPixels)(A == B);
+}
+#else // !F_PIXELS_VEC__SIMD
+#define F_PIXELS_VEC__DONE(Len) 0
+#endif // !F_PIXELS_VEC__SIMD
+
+#endif // F_INC_GRAPHICS_PIXELS_VEC_V_H
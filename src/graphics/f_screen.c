@@ -18,9 +18,24 @@
 #include "f_screen.v.h"
 #include <faur.v.h>
 
-FScreen f__screen;
+F__RENDER_LOCAL FScreen f__screen;
 static F_LISTINTR(g_stack, FScreen, listNode);
 
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+    // Past this many separate areas, merge the new one into its neighbor
+    #define F__DAMAGE_RECTS_NUM 8
+
+    // Areas of the screen drawn to since the last screen show
+    static struct {
+        FScreenRect rects[F__DAMAGE_RECTS_NUM];
+        unsigned num;
+        bool all;
+        #if F__RENDER_BANDS
+            bool locked; // band threads are replaying recorded draws
+        #endif
+    } g_damage = {.all = true};
+#endif
+
 #if F_CONFIG_TRAIT_DESKTOP && F_CONFIG_TRAIT_KEYBOARD
     static FButton* g_fullScreenButton;
 
@@ -102,13 +117,27 @@ void f_screen__draw(void)
         F__FATAL("Screen target stack is not empty");
     }
 
+    #if F__RENDER_BANDS
+        f_platform_software_bands__flush();
+    #endif
+
     f_platform_api__screenShow();
+
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        g_damage.num = 0;
+        g_damage.all = false;
+    #endif
 }
 
 FColorPixel* f_screen_pixelsGetBuffer(void)
 {
     f_platform_api__screenTextureSync();
 
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        // Caller can write anywhere in the buffer
+        f_screen__damageAddAll();
+    #endif
+
     return f_screen__bufferGetFrom(0, 0);
 }
 
@@ -131,13 +160,27 @@ void f_screen_clear(void)
 {
     f_platform_api__screenClear();
 
+    #if F__RENDER_BANDS
+        // Pending draws would be painted over anyway
+        f_platform_software_bands__discard();
+    #endif
+
     f_pixels__fill(f__screen.pixels, f__screen.frame, f__color.pixel);
+
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        f_screen__damageAddAll();
+    #endif
 }
 
 void f_screen_push(FSprite* Sprite, unsigned Frame)
 {
     F__CHECK(Sprite != NULL);
     F__CHECK(Frame < Sprite->pixels.framesNum);
+    F__CHECK(!f_pixels__isIndexed(&Sprite->pixels));
+
+    #if F__RENDER_BANDS
+        f_platform_software_bands__flush();
+    #endif
 
     f_listintr_push(&g_stack, f_pool__dup(F_POOL__STACK_SCREEN, &f__screen));
 
@@ -256,6 +299,10 @@ void f_screen__toSprite(FSprite* Sprite, unsigned Frame)
                  f__screen.pixels->size.y);
     }
 
+    #if F__RENDER_BANDS
+        f_platform_software_bands__flush();
+    #endif
+
     #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
         f_pixels__copyFrame(
             &Sprite->pixels, Frame, f__screen.pixels, f__screen.frame);
@@ -264,3 +311,119 @@ void f_screen__toSprite(FSprite* Sprite, unsigned Frame)
     f_platform_api__screenToTexture(
         f_platform_api__textureSpriteToScreen(Sprite->u.texture), Frame);
 }
+
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+static inline int rectArea(const FScreenRect* Rect)
+{
+    return (Rect->end.x - Rect->start.x) * (Rect->end.y - Rect->start.y);
+}
+
+static inline FScreenRect rectUnion(const FScreenRect* A, const FScreenRect* B)
+{
+    return (FScreenRect){
+        {f_math_min(A->start.x, B->start.x),
+         f_math_min(A->start.y, B->start.y)},
+        {f_math_max(A->end.x, B->end.x),
+         f_math_max(A->end.y, B->end.y)}
+    };
+}
+
+static inline bool rectTouch(const FScreenRect* A, const FScreenRect* B)
+{
+    return A->start.x <= B->end.x && B->start.x <= A->end.x
+        && A->start.y <= B->end.y && B->start.y <= A->end.y;
+}
+
+void f_screen__damageAdd(int X, int Y, int Width, int Height)
+{
+    if(g_damage.all || f__screen.sprite != NULL) {
+        return;
+    }
+
+    #if F__RENDER_BANDS
+        if(g_damage.locked) {
+            return;
+        }
+    #endif
+
+    FScreenRect rect = {
+        {f_math_max(X, f__screen.clipStart.x),
+         f_math_max(Y, f__screen.clipStart.y)},
+        {f_math_min(X + Width, f__screen.clipEnd.x),
+         f_math_min(Y + Height, f__screen.clipEnd.y)}
+    };
+
+    if(rect.start.x >= rect.end.x || rect.start.y >= rect.end.y) {
+        return;
+    }
+
+    // Absorb every area the new one overlaps or borders
+    for(unsigned i = 0; i < g_damage.num; ) {
+        if(rectTouch(&rect, &g_damage.rects[i])) {
+            rect = rectUnion(&rect, &g_damage.rects[i]);
+            g_damage.rects[i] = g_damage.rects[--g_damage.num];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if(g_damage.num < F__DAMAGE_RECTS_NUM) {
+        g_damage.rects[g_damage.num++] = rect;
+    } else {
+        // Merge into the area that grows the least
+        unsigned best = 0;
+        int bestGrowth = INT_MAX;
+
+        for(unsigned i = 0; i < g_damage.num; i++) {
+            FScreenRect u = rectUnion(&rect, &g_damage.rects[i]);
+            int growth = rectArea(&u) - rectArea(&g_damage.rects[i]);
+
+            if(growth < bestGrowth) {
+                best = i;
+                bestGrowth = growth;
+            }
+        }
+
+        g_damage.rects[best] = rectUnion(&rect, &g_damage.rects[best]);
+    }
+
+    int area = 0;
+
+    for(unsigned i = 0; i < g_damage.num; i++) {
+        area += rectArea(&g_damage.rects[i]);
+    }
+
+    // Fewer, bigger copies are cheaper past this point
+    if(area >= f__screen.pixels->size.x * f__screen.pixels->size.y / 2) {
+        f_screen__damageAddAll();
+    }
+}
+
+void f_screen__damageAddAll(void)
+{
+    if(f__screen.sprite == NULL) {
+        g_damage.all = true;
+    }
+}
+
+unsigned f_screen__damageGet(const FScreenRect** Rects)
+{
+    if(g_damage.all) {
+        g_damage.rects[0] =
+            (FScreenRect){{0, 0}, f__screen.pixels->size};
+        g_damage.num = 1;
+    }
+
+    *Rects = g_damage.rects;
+
+    return g_damage.num;
+}
+
+#if F__RENDER_BANDS
+void f_screen__damageLock(bool Lock)
+{
+    g_damage.locked = Lock;
+}
+#endif
+#endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
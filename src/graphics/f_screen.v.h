@@ -21,8 +21,10 @@
 #include "f_screen.p.h"
 
 typedef struct FScreen FScreen;
+typedef struct FScreenRect FScreenRect;
 
 #include "../general/f_init.v.h"
+#include "../graphics/f_color.v.h"
 #include "../graphics/f_sprite.v.h"
 #include "../math/f_fix.v.h"
 
@@ -36,15 +38,29 @@ struct FScreen {
     FPlatformTextureScreen* texture;
 };
 
+struct FScreenRect {
+    FVecInt start, end;
+};
+
 extern const FPack f_pack__screen;
 
-extern FScreen f__screen;
+extern F__RENDER_LOCAL FScreen f__screen;
 
 extern void f_screen__tick(void);
 extern void f_screen__draw(void);
 
 extern void f_screen__toSprite(FSprite* Sprite, unsigned Frame);
 
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+extern void f_screen__damageAdd(int X, int Y, int Width, int Height);
+extern void f_screen__damageAddAll(void);
+extern unsigned f_screen__damageGet(const FScreenRect** Rects);
+#endif
+
+#if F__RENDER_BANDS
+extern void f_screen__damageLock(bool Lock);
+#endif
+
 static inline FColorPixel* f_screen__bufferGetFrom(int X, int Y)
 {
     return f_pixels__bufferGetFrom(f__screen.pixels, f__screen.frame, X, Y);
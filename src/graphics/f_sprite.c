@@ -27,8 +27,13 @@ static inline bool isConstSprite(const FSprite* Sprite)
 static inline void lazyInitTextures(const FSprite* Sprite)
 {
     if(isConstSprite(Sprite) && *(Sprite->u.textureIndirect) == NULL) {
-        *(Sprite->u.textureIndirect) =
-            f_platform_api__textureNew(&Sprite->pixels);
+        if(F_FLAGS_TEST_ANY(Sprite->pixels.flags, F_PIXELS__ATLAS)) {
+            *(Sprite->u.textureIndirect) =
+                f_atlas__textureNewEmbedded(&Sprite->pixels);
+        } else {
+            *(Sprite->u.textureIndirect) =
+                f_platform_api__textureNew(&Sprite->pixels);
+        }
     }
 }
 #endif
@@ -43,13 +48,75 @@ const FPlatformTexture* getSpriteTexture(const FSprite* Sprite)
     #endif
 }
 
-static FSprite* spriteNew(const FPixels* Pixels, int X, int Y, int FrameWidth, int FrameHeight)
+static void lutSet(FColorPixel* Lut, const FPalette* Palette)
+{
+    unsigned size = f_palette_sizeGet(Palette);
+
+    if(size >= F_PIXELS__LUT_SIZE) {
+        F__FATAL("Palette has %u colors, max is %u",
+                 size,
+                 F_PIXELS__LUT_SIZE - 1);
+    }
+
+    for(unsigned c = size; c--; ) {
+        Lut[c + 1] = f_palette_getPixel(Palette, c);
+    }
+}
+
+// Map a frame's colors to lut indices, color key to transparent index 0
+static void frameIndex(const FPixels* Dst, unsigned DstFrame, const FPixels* Src, int SrcX, int SrcY, const FPalette* Palette)
+{
+    uint8_t* dst = Dst->u.indices + DstFrame * Dst->bufferLen;
+    const FColorPixel* src = f_pixels__bufferGetFromConst(Src, 0, SrcX, SrcY);
+    unsigned size = f_palette_sizeGet(Palette);
+    unsigned last = 1;
+
+    for(int y = Dst->size.y; y--; src += Src->size.x - Dst->size.x) {
+        for(int x = Dst->size.x; x--; src++) {
+            const FColorPixel pixel = *src;
+
+            if(pixel == f_color__key) {
+                *dst++ = 0;
+
+                continue;
+            }
+
+            // Neighbors often share a color
+            if(Dst->lut[last] != pixel) {
+                unsigned c = size;
+
+                while(c && Dst->lut[c] != pixel) {
+                    c--;
+                }
+
+                if(c == 0) {
+                    FColorRgb rgb = f_color_pixelToRgb(pixel);
+
+                    F__FATAL("Color %d,%d,%d is not on the palette",
+                             rgb.r,
+                             rgb.g,
+                             rgb.b);
+                }
+
+                last = c;
+            }
+
+            *dst++ = (uint8_t)last;
+        }
+    }
+}
+
+static FSprite* spriteNew(const FPixels* Pixels, const FPalette* Palette, int X, int Y, int FrameWidth, int FrameHeight)
 {
     FVecInt gridDim;
 
     // If frame size is negative, use entire image
     if(FrameWidth < 0) {
         gridDim = Pixels->size;
+    } else if(f_pixels__isIndexed(Pixels)) {
+        // Indexed sheets have no limit color grid, use the rest of the area
+        gridDim.x = Pixels->size.x - X;
+        gridDim.y = Pixels->size.y - Y;
     } else {
         gridDim = f_pixels__boundsFind(Pixels, X, Y);
     }
@@ -74,9 +141,21 @@ static FSprite* spriteNew(const FPixels* Pixels, int X, int Y, int FrameWidth, i
     }
 
     FSprite* s = f_pool__alloc(F_POOL__SPRITE);
-
-    f_pixels__init(
-        &s->pixels, FrameWidth, FrameHeight, framesNum, F_PIXELS__ALLOC);
+    bool indexed = Palette != NULL || f_pixels__isIndexed(Pixels);
+
+    f_pixels__init(&s->pixels,
+                   FrameWidth,
+                   FrameHeight,
+                   framesNum,
+                   F_PIXELS__ALLOC | (indexed ? F_PIXELS__INDEXED : 0));
+
+    if(Palette) {
+        lutSet(s->pixels.lut, Palette);
+    } else if(indexed) {
+        memcpy(s->pixels.lut,
+               Pixels->lut,
+               F_PIXELS__LUT_SIZE * sizeof(FColorPixel));
+    }
 
     unsigned f = 0;
     int endX = X + gridDim.x - (gridDim.x % FrameWidth);
@@ -84,7 +163,11 @@ static FSprite* spriteNew(const FPixels* Pixels, int X, int Y, int FrameWidth, i
 
     for(int y = Y; y < endY; y += FrameHeight) {
         for(int x = X; x < endX; x += FrameWidth, f++) {
-            f_pixels__copyFrameEx(&s->pixels, f, Pixels, x, y);
+            if(Palette) {
+                frameIndex(&s->pixels, f, Pixels, x, y, Palette);
+            } else {
+                f_pixels__copyFrameEx(&s->pixels, f, Pixels, x, y);
+            }
         }
     }
 
@@ -93,10 +176,8 @@ static FSprite* spriteNew(const FPixels* Pixels, int X, int Y, int FrameWidth, i
     return s;
 }
 
-FSprite* f_sprite_newFromFile(const char* Path, int X, int Y, int FrameWidth, int FrameHeight)
+static FSprite* spriteNewFromFile(const char* Path, const FPalette* Palette, int X, int Y, int FrameWidth, int FrameHeight)
 {
-    F__CHECK(Path != NULL);
-
     FPixels* pixels = f_platform_api__imageRead(Path);
 
     if(pixels == NULL) {
@@ -123,20 +204,35 @@ FSprite* f_sprite_newFromFile(const char* Path, int X, int Y, int FrameWidth, in
     F__CHECK(((FrameWidth < 0) ^ (FrameHeight < 0)) == 0);
     F__CHECK(((FrameWidth < 0) && (X == 0 && Y == 0)) || (FrameWidth >= 0));
 
-    FSprite* s = spriteNew(pixels, X, Y, FrameWidth, FrameHeight);
+    FSprite* s = spriteNew(pixels, Palette, X, Y, FrameWidth, FrameHeight);
 
     f_pixels__free(pixels);
 
     return s;
 }
 
+FSprite* f_sprite_newFromFile(const char* Path, int X, int Y, int FrameWidth, int FrameHeight)
+{
+    F__CHECK(Path != NULL);
+
+    return spriteNewFromFile(Path, NULL, X, Y, FrameWidth, FrameHeight);
+}
+
+FSprite* f_sprite_newFromFileIndexed(const char* Path, const FPalette* Palette, int X, int Y, int FrameWidth, int FrameHeight)
+{
+    F__CHECK(Path != NULL);
+    F__CHECK(Palette != NULL);
+
+    return spriteNewFromFile(Path, Palette, X, Y, FrameWidth, FrameHeight);
+}
+
 FSprite* f_sprite_newFromSprite(const FSprite* Sheet, int X, int Y, int FrameWidth, int FrameHeight)
 {
     F__CHECK(Sheet != NULL);
     F__CHECK(FrameWidth >= 0);
     F__CHECK(FrameHeight >= 0);
 
-    return spriteNew(&Sheet->pixels, X, Y, FrameWidth, FrameHeight);
+    return spriteNew(&Sheet->pixels, NULL, X, Y, FrameWidth, FrameHeight);
 }
 
 FSprite* f_sprite_newBlank(int Width, int Height, unsigned Frames, bool ColorKeyed)
@@ -186,6 +282,10 @@ void f_sprite_free(FSprite* Sprite)
     f_platform_api__textureFree(Sprite->u.texture);
     f_pixels__free(&Sprite->pixels);
 
+    if(Sprite->atlasPage) {
+        f_atlas__pageRelease(Sprite->atlasPage);
+    }
+
     f_pool_release(Sprite);
 }
 
@@ -244,22 +344,66 @@ void f_sprite_blitEx(const FSprite* Sprite, unsigned Frame, int X, int Y, FFix S
                                   CenterY);
 }
 
+// Blits queued for screen bands read the sprite's pixels and lut when they
+// run, so draw them before either changes
+static void pixelsWillChange(const FSprite* Sprite)
+{
+    #if F__RENDER_BANDS
+        f_platform_software_bands__pixelsFlush(&Sprite->pixels);
+    #else
+        F_UNUSED(Sprite);
+    #endif
+}
+
+static void textureRenew(FSprite* Sprite)
+{
+    f_platform_api__textureFree(Sprite->u.texture);
+    Sprite->u.texture = f_platform_api__textureNew(&Sprite->pixels);
+
+    #if F_CONFIG_SCREEN_RENDER != F_SCREEN_RENDER_SOFTWARE
+        // The new texture is not on the atlas page anymore
+        if(Sprite->atlasPage) {
+            f_atlas__pageRelease(Sprite->atlasPage);
+            Sprite->atlasPage = NULL;
+        }
+    #endif
+}
+
+// Indexed sprites only change their lut, the indices and spans stay the same
+static void lutChanged(FSprite* Sprite)
+{
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        F_UNUSED(Sprite);
+    #else
+        textureRenew(Sprite);
+    #endif
+}
+
 void f_sprite_swapColor(FSprite* Sprite, FColorPixel OldColor, FColorPixel NewColor)
 {
     F__CHECK(Sprite != NULL);
 
-    for(unsigned f = Sprite->pixels.framesNum; f--; ) {
-        FColorPixel* buffer = f_pixels__bufferGetStart(&Sprite->pixels, f);
+    pixelsWillChange(Sprite);
+
+    if(f_pixels__isIndexed(&Sprite->pixels)) {
+        FColorPixel* lut = Sprite->pixels.lut;
 
-        for(unsigned i = Sprite->pixels.bufferLen; i--; ) {
-            if(buffer[i] == OldColor) {
-                buffer[i] = NewColor;
+        for(unsigned i = F_PIXELS__LUT_SIZE; --i; ) {
+            if(lut[i] == OldColor) {
+                lut[i] = NewColor;
             }
         }
+
+        lutChanged(Sprite);
+
+        return;
     }
 
-    f_platform_api__textureFree(Sprite->u.texture);
-    Sprite->u.texture = f_platform_api__textureNew(&Sprite->pixels);
+    for(unsigned f = Sprite->pixels.framesNum; f--; ) {
+        f_pixels__swap(&Sprite->pixels, f, &OldColor, &NewColor, 1);
+    }
+
+    textureRenew(Sprite);
 }
 
 void f_sprite_swapColors(FSprite* Sprite, const FColorPixel* OldColors, const FColorPixel* NewColors, unsigned NumColors)
@@ -269,23 +413,44 @@ void f_sprite_swapColors(FSprite* Sprite, const FColorPixel* OldColors, const FC
     F__CHECK(NewColors != NULL);
     F__CHECK(NumColors > 0);
 
-    for(unsigned f = Sprite->pixels.framesNum; f--; ) {
-        FColorPixel* buffer = f_pixels__bufferGetStart(&Sprite->pixels, f);
+    pixelsWillChange(Sprite);
 
-        for(unsigned i = Sprite->pixels.bufferLen; i--; ) {
-            const FColorPixel pixel = buffer[i];
+    if(f_pixels__isIndexed(&Sprite->pixels)) {
+        FColorPixel* lut = Sprite->pixels.lut;
 
+        for(unsigned i = F_PIXELS__LUT_SIZE; --i; ) {
             for(unsigned c = NumColors; c--; ) {
-                if(pixel == OldColors[c]) {
-                    buffer[i] = NewColors[c];
+                if(lut[i] == OldColors[c]) {
+                    lut[i] = NewColors[c];
                     break;
                 }
             }
         }
+
+        lutChanged(Sprite);
+
+        return;
     }
 
-    f_platform_api__textureFree(Sprite->u.texture);
-    Sprite->u.texture = f_platform_api__textureNew(&Sprite->pixels);
+    for(unsigned f = Sprite->pixels.framesNum; f--; ) {
+        f_pixels__swap(&Sprite->pixels, f, OldColors, NewColors, NumColors);
+    }
+
+    textureRenew(Sprite);
+}
+
+void f_sprite_paletteSet(FSprite* Sprite, const FPalette* Palette)
+{
+    F__CHECK(Sprite != NULL);
+    F__CHECK(Palette != NULL);
+
+    if(!f_pixels__isIndexed(&Sprite->pixels)) {
+        F__FATAL("f_sprite_paletteSet: Sprite is not indexed");
+    }
+
+    pixelsWillChange(Sprite);
+    lutSet(Sprite->pixels.lut, Palette);
+    lutChanged(Sprite);
 }
 
 FVecInt f_sprite_sizeGet(const FSprite* Sprite)
@@ -320,6 +485,7 @@ const FColorPixel* f_sprite_pixelsGetBuffer(const FSprite* Sprite, unsigned Fram
 {
     F__CHECK(Sprite != NULL);
     F__CHECK(Frame < Sprite->pixels.framesNum);
+    F__CHECK(!f_pixels__isIndexed(&Sprite->pixels));
 
     return f_pixels__bufferGetStartConst(&Sprite->pixels, Frame);
 }
@@ -329,5 +495,12 @@ FColorPixel f_sprite_pixelsGetValue(const FSprite* Sprite, unsigned Frame, int X
     F__CHECK(Sprite != NULL);
     F__CHECK(Frame < Sprite->pixels.framesNum);
 
+    if(f_pixels__isIndexed(&Sprite->pixels)) {
+        uint8_t index =
+            *f_pixels__indicesGetFromConst(&Sprite->pixels, Frame, X, Y);
+
+        return index ? Sprite->pixels.lut[index] : f_color__key;
+    }
+
     return f_pixels__bufferGetValue(&Sprite->pixels, Frame, X, Y);
 }
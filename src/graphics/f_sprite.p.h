@@ -26,6 +26,7 @@ typedef struct FSprite FSprite;
 #include "../math/f_vec.p.h"
 
 extern FSprite* f_sprite_newFromFile(const char* Path, int X, int Y, int FrameWidth, int FrameHeight);
+extern FSprite* f_sprite_newFromFileIndexed(const char* Path, const FPalette* Palette, int X, int Y, int FrameWidth, int FrameHeight);
 extern FSprite* f_sprite_newFromSprite(const FSprite* Sheet, int X, int Y, int FrameWidth, int FrameHeight);
 extern FSprite* f_sprite_newBlank(int Width, int Height, unsigned Frames, bool ColorKeyed);
 extern FSprite* f_sprite_dup(const FSprite* Sprite);
@@ -36,6 +37,7 @@ extern void f_sprite_blitEx(const FSprite* Sprite, unsigned Frame, int X, int Y,
 
 extern void f_sprite_swapColor(FSprite* Sprite, FColorPixel OldColor, FColorPixel NewColor);
 extern void f_sprite_swapColors(FSprite* Sprite, const FColorPixel* OldColors, const FColorPixel* NewColors, unsigned NumColors);
+extern void f_sprite_paletteSet(FSprite* Sprite, const FPalette* Palette);
 
 extern FVecInt f_sprite_sizeGet(const FSprite* Sprite);
 extern int f_sprite_sizeGetWidth(const FSprite* Sprite);
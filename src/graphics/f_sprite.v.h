@@ -20,6 +20,7 @@
 
 #include "f_sprite.p.h"
 
+#include "../graphics/f_atlas.v.h"
 #include "../platform/f_platform.v.h"
 
 struct FSprite {
@@ -29,6 +30,7 @@ struct FSprite {
         const FPlatformTexture* textureConst; // const software sprites
         FPlatformTexture** textureIndirect; // const accelerated sprites
     } u;
+    FAtlasPage* atlasPage; // set if the sprite was placed on an atlas page
 };
 
 #endif // F_INC_GRAPHICS_SPRITE_V_H
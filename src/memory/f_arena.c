@@ -0,0 +1,119 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_arena.v.h"
+#include <faur.v.h>
+
+#if F_CONFIG_TRAIT_LOW_MEM
+    #define F__FRAME_BLOCK_SIZE 1024
+#else
+    #define F__FRAME_BLOCK_SIZE (64 * 1024)
+#endif
+
+#define F__ALIGN_SIZE(Size)                              \
+    (((Size) + sizeof(FMaxMemAlignType) - 1)             \
+        & ~(size_t)(sizeof(FMaxMemAlignType) - 1))
+
+// Bump allocator for data that only lives until the end of the frame.
+// Not thread-safe, only call from the main thread.
+static FArenaBlock* g_frame; // Newest block, where allocations happen
+
+static FArenaBlock* blockNew(size_t Size, FArenaBlock* NextBlock)
+{
+    FArenaBlock* b =
+        f_mem_malloc(sizeof(FArenaBlock) - sizeof(FMaxMemAlignType) + Size);
+
+    b->nextBlock = NextBlock;
+    b->size = Size;
+    b->used = 0;
+
+    return b;
+}
+
+static void blocksFree(FArenaBlock* Block)
+{
+    while(Block != NULL) {
+        FArenaBlock* next = Block->nextBlock;
+
+        f_mem_free(Block);
+
+        Block = next;
+    }
+}
+
+static void f_arena__uninit(void)
+{
+    blocksFree(g_frame);
+    g_frame = NULL;
+}
+
+const FPack f_pack__arena = {
+    "Arena",
+    NULL,
+    f_arena__uninit,
+};
+
+void* f_arena_frameAlloc(size_t Size)
+{
+    F__CHECK(Size > 0);
+
+    size_t size = F__ALIGN_SIZE(Size);
+
+    if(g_frame == NULL || g_frame->size - g_frame->used < size) {
+        size_t blockSize = f_math_maxz(
+                            size,
+                            g_frame ? g_frame->size * 2 : F__FRAME_BLOCK_SIZE);
+
+        g_frame = blockNew(blockSize, g_frame);
+    }
+
+    void* buffer = (uint8_t*)g_frame->buffer + g_frame->used;
+
+    g_frame->used += size;
+
+    return buffer;
+}
+
+void* f_arena_frameAllocz(size_t Size)
+{
+    void* buffer = f_arena_frameAlloc(Size);
+
+    memset(buffer, 0, Size);
+
+    return buffer;
+}
+
+void f_arena__frameReset(void)
+{
+    if(g_frame == NULL) {
+        return;
+    }
+
+    if(g_frame->nextBlock != NULL) {
+        // Last frame spilled over, get one block that fits all of it
+        size_t total = 0;
+
+        for(FArenaBlock* b = g_frame; b != NULL; b = b->nextBlock) {
+            total += b->size;
+        }
+
+        blocksFree(g_frame);
+        g_frame = blockNew(total, NULL);
+    }
+
+    g_frame->used = 0;
+}
@@ -26,11 +26,13 @@
     #define F__ENTRIES_NUM_MAX 1024
 #endif
 
+// Entries a thread moves between its magazine and a shared pool at once
+#define F__MAGAZINE_SIZE 16
+
 static const unsigned g_sizes[F_POOL__NUM] = {
     [F_POOL__BLOCK] = sizeof(FBlock),
     [F_POOL__CONSOLE] = sizeof(FConsoleLine),
     [F_POOL__ENTITY] = sizeof(FEntity),
-    [F_POOL__HASHENTRY] = sizeof(F__HashEntry),
     [F_POOL__LIST] = sizeof(FList),
     [F_POOL__LISTINTR] = sizeof(FListIntr),
     [F_POOL__LISTNODE] = sizeof(FListNode),
@@ -46,21 +48,224 @@ static const unsigned g_sizes[F_POOL__NUM] = {
     [F_POOL__TIMER] = sizeof(FTimer),
 };
 
+#if F_CONFIG_DEBUG
+static const char* g_names[F_POOL__NUM] = {
+    [F_POOL__BLOCK] = "Block",
+    [F_POOL__CONSOLE] = "Console",
+    [F_POOL__ENTITY] = "Entity",
+    [F_POOL__LIST] = "List",
+    [F_POOL__LISTINTR] = "ListIntr",
+    [F_POOL__LISTNODE] = "ListNode",
+    [F_POOL__PATH] = "Path",
+    [F_POOL__SAMPLE] = "Sample",
+    [F_POOL__SPRITE] = "Sprite",
+    [F_POOL__SPRITE_LAYER] = "SpriteLayer",
+    [F_POOL__STACK_ALIGN] = "StackAlign",
+    [F_POOL__STACK_COLOR] = "StackColor",
+    [F_POOL__STACK_FONT] = "StackFont",
+    [F_POOL__STACK_SCREEN] = "StackScreen",
+    [F_POOL__STACK_STATE] = "StackState",
+    [F_POOL__TIMER] = "Timer",
+};
+#endif
+
 static FPool* g_pools[F_POOL__NUM];
 
+static void f_pool__init(void)
+{
+    #if F_CONFIG_LIB_PTHREAD
+        // Worker threads would race to create pools on first use
+        for(int p = F_POOL__NUM; p--; ) {
+            g_pools[p] = f_pool_newShared(g_sizes[p]);
+        }
+    #endif
+}
+
 static void f_pool__uninit(void)
 {
     for(int p = F_POOL__NUM; p--; ) {
+        #if F_CONFIG_DEBUG
+            if(g_pools[p] != NULL) {
+                const FPoolStats s = f_pool_statsGet(g_pools[p]);
+
+                f_out__info("Pool %s: %u live, %u peak, %u/%u in %u slabs",
+                            g_names[p],
+                            s.numLive,
+                            s.numPeak,
+                            s.numEntries - s.numLive,
+                            s.numEntries,
+                            s.numSlabs);
+            }
+        #endif
+
         f_pool_free(g_pools[p]);
     }
 }
 
 const FPack f_pack__pool = {
     "Pool",
-    NULL,
+    f_pool__init,
     f_pool__uninit
 };
 
+#if !F_CONFIG_DEBUG_MEM_POOL
+static FPoolEntryHeader* entryTake(FPool* Pool)
+{
+    if(Pool->freeEntryList == NULL) {
+        FPoolSlab* s =
+            f_mem_malloc(sizeof(FPoolSlab) - sizeof(FPoolEntryHeader)
+                            + Pool->numEntriesPerSlab * Pool->entrySize);
+
+        s->nextSlab = Pool->slabList;
+        s->numEntries = Pool->numEntriesPerSlab;
+
+        Pool->slabList = s;
+        Pool->freeEntryList = s->buffer;
+
+        FPoolEntryHeader* entry;
+        FPoolEntryHeader* lastEntry = s->buffer;
+
+        for(unsigned e = 1; e < Pool->numEntriesPerSlab; e++) {
+            entry = (FPoolEntryHeader*)
+                        ((uintptr_t)s->buffer + e * Pool->entrySize);
+
+            lastEntry->nextFreeEntry = entry;
+            lastEntry = entry;
+        }
+
+        lastEntry->nextFreeEntry = NULL;
+
+        Pool->stats.numSlabs++;
+        Pool->stats.numEntries += Pool->numEntriesPerSlab;
+
+        Pool->numEntriesPerSlab =
+            f_math_minu(Pool->numEntriesPerSlab * 2, F__ENTRIES_NUM_MAX);
+    }
+
+    FPoolEntryHeader* entry = Pool->freeEntryList;
+
+    Pool->freeEntryList = entry->nextFreeEntry;
+
+    if(++Pool->stats.numLive > Pool->stats.numPeak) {
+        Pool->stats.numPeak = Pool->stats.numLive;
+    }
+
+    return entry;
+}
+
+static void entryGive(FPool* Pool, FPoolEntryHeader* Entry)
+{
+    Entry->nextFreeEntry = Pool->freeEntryList;
+    Pool->freeEntryList = Entry;
+
+    Pool->stats.numLive--;
+}
+#endif
+
+#if F_CONFIG_LIB_PTHREAD && !F_CONFIG_DEBUG_MEM_POOL
+// Call with the pool mutex locked
+static void magazineDrain(FPoolMagazine* Magazine, unsigned Num)
+{
+    while(Num--) {
+        FPoolEntryHeader* entry = Magazine->freeEntryList;
+
+        Magazine->freeEntryList = entry->nextFreeEntry;
+        Magazine->numFree--;
+
+        entryGive(Magazine->pool, entry);
+    }
+}
+
+// Runs when a thread that used the pool exits
+static void magazineFree(void* Magazine)
+{
+    FPoolMagazine* m = Magazine;
+    FPool* pool = m->pool;
+
+    f_platform_pthread__mutexLock(pool->mutex);
+
+    magazineDrain(m, m->numFree);
+
+    for(FPoolMagazine** link = &pool->magazineList;
+        *link != NULL;
+        link = &(*link)->nextMagazine) {
+
+        if(*link == m) {
+            *link = m->nextMagazine;
+            break;
+        }
+    }
+
+    f_platform_pthread__mutexUnlock(pool->mutex);
+
+    f_mem_free(m);
+}
+
+static FPoolMagazine* magazineGet(FPool* Pool)
+{
+    FPoolMagazine* m = f_platform_pthread__tlsGet(Pool->magazine);
+
+    if(m == NULL) {
+        m = f_mem_mallocz(sizeof(FPoolMagazine));
+        m->pool = Pool;
+
+        f_platform_pthread__mutexLock(Pool->mutex);
+
+        m->nextMagazine = Pool->magazineList;
+        Pool->magazineList = m;
+
+        f_platform_pthread__mutexUnlock(Pool->mutex);
+
+        f_platform_pthread__tlsSet(Pool->magazine, m);
+    }
+
+    return m;
+}
+
+static FPoolEntryHeader* magazineTake(FPool* Pool)
+{
+    FPoolMagazine* m = magazineGet(Pool);
+
+    if(m->freeEntryList == NULL) {
+        f_platform_pthread__mutexLock(Pool->mutex);
+
+        for(unsigned e = F__MAGAZINE_SIZE; e--; ) {
+            FPoolEntryHeader* entry = entryTake(Pool);
+
+            entry->nextFreeEntry = m->freeEntryList;
+            m->freeEntryList = entry;
+        }
+
+        f_platform_pthread__mutexUnlock(Pool->mutex);
+
+        m->numFree = F__MAGAZINE_SIZE;
+    }
+
+    FPoolEntryHeader* entry = m->freeEntryList;
+
+    m->freeEntryList = entry->nextFreeEntry;
+    m->numFree--;
+
+    return entry;
+}
+
+static void magazineGive(FPool* Pool, FPoolEntryHeader* Entry)
+{
+    FPoolMagazine* m = magazineGet(Pool);
+
+    Entry->nextFreeEntry = m->freeEntryList;
+    m->freeEntryList = Entry;
+
+    if(++m->numFree >= 2 * F__MAGAZINE_SIZE) {
+        f_platform_pthread__mutexLock(Pool->mutex);
+
+        magazineDrain(m, F__MAGAZINE_SIZE);
+
+        f_platform_pthread__mutexUnlock(Pool->mutex);
+    }
+}
+#endif
+
 FPool* f_pool_new(size_t Size)
 {
     F__CHECK(Size > 0);
@@ -76,12 +281,41 @@ FPool* f_pool_new(size_t Size)
     return p;
 }
 
+FPool* f_pool_newShared(size_t Size)
+{
+    FPool* p = f_pool_new(Size);
+
+    #if F_CONFIG_LIB_PTHREAD && !F_CONFIG_DEBUG_MEM_POOL
+        p->mutex = f_platform_pthread__mutexNew();
+        p->magazine = f_platform_pthread__tlsNew(magazineFree);
+    #endif
+
+    return p;
+}
+
 void f_pool_free(FPool* Pool)
 {
     if(Pool == NULL) {
         return;
     }
 
+    #if F_CONFIG_LIB_PTHREAD
+        if(Pool->mutex != NULL) {
+            // Exiting threads no longer drain into the pool after this
+            f_platform_pthread__tlsFree(Pool->magazine);
+
+            for(FPoolMagazine* m = Pool->magazineList; m != NULL; ) {
+                FPoolMagazine* nextMagazine = m->nextMagazine;
+
+                f_mem_free(m);
+
+                m = nextMagazine;
+            }
+
+            f_platform_pthread__mutexFree(Pool->mutex);
+        }
+    #endif
+
     for(FPoolSlab* slab = Pool->slabList; slab != NULL; ) {
         FPoolSlab* nextSlab = slab->nextSlab;
 
@@ -100,43 +334,36 @@ void* f_pool_alloc(FPool* Pool)
     #if F_CONFIG_DEBUG_MEM_POOL
         return f_mem_mallocz(Pool->objSize);
     #else
-        if(Pool->freeEntryList == NULL) {
-            FPoolSlab* s =
-                f_mem_malloc(sizeof(FPoolSlab) - sizeof(FPoolEntryHeader)
-                                + Pool->numEntriesPerSlab * Pool->entrySize);
+        void* userBuffer = f_pool_allocRaw(Pool);
 
-            s->nextSlab = Pool->slabList;
+        memset(userBuffer, 0, Pool->objSize);
 
-            Pool->slabList = s;
-            Pool->freeEntryList = s->buffer;
+        return userBuffer;
+    #endif
+}
 
-            FPoolEntryHeader* entry;
-            FPoolEntryHeader* lastEntry = s->buffer;
+void* f_pool_allocRaw(FPool* Pool)
+{
+    F__CHECK(Pool != NULL);
 
-            for(unsigned e = 1; e < Pool->numEntriesPerSlab; e++) {
-                entry = (FPoolEntryHeader*)
-                            ((uintptr_t)s->buffer + e * Pool->entrySize);
+    #if F_CONFIG_DEBUG_MEM_POOL
+        return f_mem_malloc(Pool->objSize);
+    #else
+        FPoolEntryHeader* entry;
 
-                lastEntry->nextFreeEntry = entry;
-                lastEntry = entry;
+        #if F_CONFIG_LIB_PTHREAD
+            if(Pool->mutex != NULL) {
+                entry = magazineTake(Pool);
+            } else {
+                entry = entryTake(Pool);
             }
+        #else
+            entry = entryTake(Pool);
+        #endif
 
-            lastEntry->nextFreeEntry = NULL;
-
-            Pool->numEntriesPerSlab =
-                f_math_minu(Pool->numEntriesPerSlab * 2, F__ENTRIES_NUM_MAX);
-        }
-
-        FPoolEntryHeader* entry = Pool->freeEntryList;
-
-        Pool->freeEntryList = entry->nextFreeEntry;
         entry->parentPool = Pool;
 
-        void* userBuffer = entry + 1;
-
-        memset(userBuffer, 0, Pool->objSize);
-
-        return userBuffer;
+        return entry + 1;
     #endif
 }
 
@@ -152,11 +379,178 @@ void f_pool_release(void* Buffer)
         FPoolEntryHeader* entry = (FPoolEntryHeader*)Buffer - 1;
         FPool* pool = entry->parentPool;
 
-        entry->nextFreeEntry = pool->freeEntryList;
-        pool->freeEntryList = entry;
+        #if F_CONFIG_LIB_PTHREAD
+            if(pool->mutex != NULL) {
+                magazineGive(pool, entry);
+            } else {
+                entryGive(pool, entry);
+            }
+        #else
+            entryGive(pool, entry);
+        #endif
     #endif
 }
 
+#if !F_CONFIG_DEBUG_MEM_POOL
+static int slabCmp(const void* A, const void* B)
+{
+    uintptr_t a = (uintptr_t)*(const FPoolSlab* const*)A;
+    uintptr_t b = (uintptr_t)*(const FPoolSlab* const*)B;
+
+    return (a > b) - (a < b);
+}
+
+static unsigned slabFind(const FPool* Pool, FPoolSlab* const* Slabs, unsigned NumSlabs, const FPoolEntryHeader* Entry)
+{
+    uintptr_t address = (uintptr_t)Entry;
+    unsigned low = 0;
+    unsigned high = NumSlabs;
+
+    // Find the last slab that starts at or before the entry
+    while(high - low > 1) {
+        unsigned mid = low + (high - low) / 2;
+
+        if((uintptr_t)Slabs[mid]->buffer <= address) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+
+    F__CHECK(address < (uintptr_t)Slabs[low]->buffer
+                        + Slabs[low]->numEntries * Pool->entrySize);
+
+    return low;
+}
+
+static void slabsTrim(FPool* Pool)
+{
+    unsigned numSlabs = Pool->stats.numSlabs;
+
+    if(numSlabs == 0) {
+        return;
+    }
+
+    // Sort slabs by address to map free entries back to their slab
+    FPoolSlab** slabs = f_mem_malloc(numSlabs * sizeof(FPoolSlab*));
+    unsigned* numFree = f_mem_mallocz(numSlabs * sizeof(unsigned));
+    unsigned i = 0;
+
+    for(FPoolSlab* s = Pool->slabList; s != NULL; s = s->nextSlab) {
+        slabs[i++] = s;
+    }
+
+    qsort(slabs, numSlabs, sizeof(FPoolSlab*), slabCmp);
+
+    for(FPoolEntryHeader* e = Pool->freeEntryList;
+        e != NULL;
+        e = e->nextFreeEntry) {
+
+        numFree[slabFind(Pool, slabs, numSlabs, e)]++;
+    }
+
+    // Unlink the free entries that live in fully-free slabs
+    FPoolEntryHeader** link = &Pool->freeEntryList;
+
+    while(*link != NULL) {
+        unsigned s = slabFind(Pool, slabs, numSlabs, *link);
+
+        if(numFree[s] == slabs[s]->numEntries) {
+            *link = (*link)->nextFreeEntry;
+        } else {
+            link = &(*link)->nextFreeEntry;
+        }
+    }
+
+    Pool->slabList = NULL;
+
+    for(i = numSlabs; i--; ) {
+        FPoolSlab* s = slabs[i];
+
+        if(numFree[i] == s->numEntries) {
+            Pool->stats.numSlabs--;
+            Pool->stats.numEntries -= s->numEntries;
+
+            f_mem_free(s);
+        } else {
+            s->nextSlab = Pool->slabList;
+            Pool->slabList = s;
+        }
+    }
+
+    if(Pool->slabList == NULL) {
+        // Start growing from small slabs again
+        Pool->numEntriesPerSlab = F__ENTRIES_NUM_START;
+    }
+
+    f_mem_free(slabs);
+    f_mem_free(numFree);
+}
+#endif
+
+void f_pool_trim(FPool* Pool)
+{
+    F__CHECK(Pool != NULL);
+
+    #if !F_CONFIG_DEBUG_MEM_POOL
+        #if F_CONFIG_LIB_PTHREAD
+            if(Pool->mutex != NULL) {
+                f_platform_pthread__mutexLock(Pool->mutex);
+                slabsTrim(Pool);
+                f_platform_pthread__mutexUnlock(Pool->mutex);
+
+                return;
+            }
+        #endif
+
+        slabsTrim(Pool);
+    #endif
+}
+
+void f_pool_trimAll(void)
+{
+    for(int p = F_POOL__NUM; p--; ) {
+        if(g_pools[p] != NULL) {
+            f_pool_trim(g_pools[p]);
+        }
+    }
+}
+
+FPoolStats f_pool_statsGet(const FPool* Pool)
+{
+    F__CHECK(Pool != NULL);
+
+    #if F_CONFIG_LIB_PTHREAD
+        if(Pool->mutex != NULL) {
+            f_platform_pthread__mutexLock(Pool->mutex);
+            FPoolStats stats = Pool->stats;
+            f_platform_pthread__mutexUnlock(Pool->mutex);
+
+            return stats;
+        }
+    #endif
+
+    return Pool->stats;
+}
+
+FPoolStats f_pool__statsGetTotal(void)
+{
+    FPoolStats total = {0, 0, 0, 0};
+
+    for(int p = F_POOL__NUM; p--; ) {
+        if(g_pools[p] != NULL) {
+            FPoolStats stats = f_pool_statsGet(g_pools[p]);
+
+            total.numLive += stats.numLive;
+            total.numPeak += stats.numPeak;
+            total.numSlabs += stats.numSlabs;
+            total.numEntries += stats.numEntries;
+        }
+    }
+
+    return total;
+}
+
 void* f_pool__alloc(FPoolId Pool)
 {
     if(g_pools[Pool] == NULL) {
@@ -166,9 +560,18 @@ void* f_pool__alloc(FPoolId Pool)
     return f_pool_alloc(g_pools[Pool]);
 }
 
+void* f_pool__allocRaw(FPoolId Pool)
+{
+    if(g_pools[Pool] == NULL) {
+        g_pools[Pool] = f_pool_new(g_sizes[Pool]);
+    }
+
+    return f_pool_allocRaw(g_pools[Pool]);
+}
+
 void* f_pool__dup(FPoolId Pool, const void* Buffer)
 {
-    void* copy = f_pool__alloc(Pool);
+    void* copy = f_pool__allocRaw(Pool);
 
     memcpy(copy, Buffer, g_sizes[Pool]);
 
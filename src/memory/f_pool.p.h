@@ -22,10 +22,24 @@
 
 typedef struct FPool FPool;
 
+typedef struct {
+    unsigned numLive; // Objects currently allocated or cached by threads
+    unsigned numPeak; // Most objects ever allocated at the same time
+    unsigned numSlabs; // Slabs currently held by the pool
+    unsigned numEntries; // Total object capacity of those slabs
+} FPoolStats;
+
 extern FPool* f_pool_new(size_t Size);
+extern FPool* f_pool_newShared(size_t Size);
 extern void f_pool_free(FPool* Pool);
 
 extern void* f_pool_alloc(FPool* Pool);
+extern void* f_pool_allocRaw(FPool* Pool);
 extern void f_pool_release(void* Buffer);
 
+extern void f_pool_trim(FPool* Pool);
+extern void f_pool_trimAll(void);
+
+extern FPoolStats f_pool_statsGet(const FPool* Pool);
+
 #endif // F_INC_MEMORY_POOL_P_H
@@ -24,7 +24,6 @@ typedef enum {
     F_POOL__BLOCK,
     F_POOL__CONSOLE,
     F_POOL__ENTITY,
-    F_POOL__HASHENTRY,
     F_POOL__LIST,
     F_POOL__LISTINTR,
     F_POOL__LISTNODE,
@@ -42,10 +41,12 @@ typedef enum {
 } FPoolId;
 
 typedef union FPoolEntryHeader FPoolEntryHeader;
+typedef struct FPoolMagazine FPoolMagazine;
 typedef struct FPoolSlab FPoolSlab;
 
 #include "../general/f_init.v.h"
 #include "../memory/f_mem.v.h"
+#include "../platform/threads/f_pthread_threads.v.h"
 
 union FPoolEntryHeader {
     FPoolEntryHeader* nextFreeEntry; // Next free entry in a slab
@@ -55,20 +56,37 @@ union FPoolEntryHeader {
 
 struct FPoolSlab {
     FPoolSlab* nextSlab; // Next slab in a pool's slab list
+    unsigned numEntries; // How many entries this slab holds
     FPoolEntryHeader buffer[1]; // Memory space for objects
 };
 
+struct FPoolMagazine {
+    FPool* pool; // Pool this thread-local cache belongs to
+    FPoolMagazine* nextMagazine; // Next magazine in the pool's list
+    FPoolEntryHeader* freeEntryList; // Entries this thread can use unlocked
+    unsigned numFree; // Length of freeEntryList
+};
+
 struct FPool {
     unsigned objSize; // Size of a user object within a pool entry
     unsigned entrySize; // Size of each pool entry in a slab
     unsigned numEntriesPerSlab; // Grows with usage
     FPoolSlab* slabList; // Keeps track of all allocated slabs
     FPoolEntryHeader* freeEntryList; // Head of the free pool entries list
+    FPoolStats stats; // Live objects, high-water mark, and slab counts
+    #if F_CONFIG_LIB_PTHREAD
+        FPthreadMutex* mutex; // Only set for shared pools
+        FPthreadTls* magazine; // Each thread's FPoolMagazine
+        FPoolMagazine* magazineList; // All the magazines, to free with pool
+    #endif
 };
 
 extern const FPack f_pack__pool;
 
 extern void* f_pool__alloc(FPoolId Pool);
+extern void* f_pool__allocRaw(FPoolId Pool);
 extern void* f_pool__dup(FPoolId Pool, const void* Buffer);
 
+extern FPoolStats f_pool__statsGetTotal(void);
+
 #endif // F_INC_MEMORY_POOL_V_H
@@ -34,6 +34,8 @@
 
 #include "graphics/f_sdl_blit.v.h"
 #include "graphics/f_sdl_draw.v.h"
+#include "graphics/f_sdl_queue.v.h"
+#include "graphics/f_software_bands.v.h"
 #include "graphics/f_software_blit.v.h"
 #include "graphics/f_software_draw.v.h"
 
@@ -56,6 +58,8 @@
 #include "system/f_sdl.v.h"
 #include "system/f_wiz.v.h"
 
+#include "threads/f_pthread_threads.v.h"
+
 #include "video/f_gamebuino_video.v.h"
 #include "video/f_odroid_go_video.v.h"
 #include "video/f_sdl_video.v.h"
@@ -94,20 +98,39 @@ static void f_platform__init(void)
         f_platform_odroid_go__init();
     #endif
 
+    #if F_CONFIG_LIB_PTHREAD
+        f_platform_pthread__init();
+    #endif
+
     f_platform_api__screenInit();
 
     #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
         f_out__info("Using S/W graphics");
         f_platform_software_blit__init();
+
+        #if F__RENDER_BANDS
+            f_platform_software_bands__init();
+        #endif
     #elif F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
         f_out__info("Using SDL2 graphics");
+
+        #if F_CONFIG_SCREEN_RENDER_QUEUE
+            f_platform_sdl_queue__init();
+        #endif
     #endif
 }
 
 static void f_platform__uninit(void)
 {
     #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+        #if F__RENDER_BANDS
+            f_platform_software_bands__uninit();
+        #endif
+
         f_platform_software_blit__uninit();
+    #elif F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2 \
+        && F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__uninit();
     #endif
 
     f_platform_api__screenUninit();
@@ -123,6 +146,10 @@ static void f_platform__uninit(void)
     #if F_CONFIG_LIB_SDL
         f_platform_sdl__uninit();
     #endif
+
+    #if F_CONFIG_LIB_PTHREAD
+        f_platform_pthread__uninit();
+    #endif
 }
 
 const FPack f_pack__platform = {
@@ -184,29 +211,61 @@ static const FPlatformApi f__platform_api = {
         .screenSizeGet = f_platform_api_odroidgo__screenSizeGet,
     #endif
 
-    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+    #if F__RENDER_BANDS
+        .screenTextureSync = f_platform_software_bands__flush,
+    #endif
+
+    #if F__RENDER_BANDS
+        .drawPixel = f_platform_api_bands__drawPixel,
+        .drawPixels = f_platform_api_bands__drawPixels,
+        .drawLine = f_platform_api_bands__drawLine,
+        .drawLines = f_platform_api_bands__drawLines,
+        .drawLineH = f_platform_api_bands__drawLineH,
+        .drawLineV = f_platform_api_bands__drawLineV,
+        .drawRectangleOutline = f_platform_api_bands__drawRectangleOutline,
+        .drawRectangleFilled = f_platform_api_bands__drawRectangleFilled,
+        .drawRectanglesOutline = f_platform_api_bands__drawRectanglesOutline,
+        .drawRectanglesFilled = f_platform_api_bands__drawRectanglesFilled,
+        .drawCircleOutline = f_platform_api_bands__drawCircleOutline,
+        .drawCircleFilled = f_platform_api_bands__drawCircleFilled,
+    #elif F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
         .drawPixel = f_platform_api_software__drawPixel,
+        .drawPixels = f_platform_api_software__drawPixels,
         .drawLine = f_platform_api_software__drawLine,
+        .drawLines = f_platform_api_software__drawLines,
         .drawLineH = f_platform_api_software__drawLineH,
         .drawLineV = f_platform_api_software__drawLineV,
         .drawRectangleOutline = f_platform_api_software__drawRectangleOutline,
         .drawRectangleFilled = f_platform_api_software__drawRectangleFilled,
+        .drawRectanglesOutline = f_platform_api_software__drawRectanglesOutline,
+        .drawRectanglesFilled = f_platform_api_software__drawRectanglesFilled,
         .drawCircleOutline = f_platform_api_software__drawCircleOutline,
         .drawCircleFilled = f_platform_api_software__drawCircleFilled,
     #elif F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
         .drawPixel = f_platform_api_sdl__drawPixel,
+        .drawPixels = f_platform_api_sdl__drawPixels,
         .drawLine = f_platform_api_sdl__drawLine,
+        .drawLines = f_platform_api_sdl__drawLines,
         .drawLineH = f_platform_api_sdl__drawLineH,
         .drawLineV = f_platform_api_sdl__drawLineV,
         .drawRectangleOutline = f_platform_api_sdl__drawRectangleOutline,
         .drawRectangleFilled = f_platform_api_sdl__drawRectangleFilled,
+        .drawRectanglesOutline = f_platform_api_sdl__drawRectanglesOutline,
+        .drawRectanglesFilled = f_platform_api_sdl__drawRectanglesFilled,
         .drawCircleOutline = f_platform_api_sdl__drawCircleOutline,
         .drawCircleFilled = f_platform_api_sdl__drawCircleFilled,
         .drawSetColor = f_platform_api_sdl__drawSetColor,
         .drawSetBlend = f_platform_api_sdl__drawSetBlend,
     #endif
 
-    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+    #if F__RENDER_BANDS
+        .textureNew = f_platform_api_software__textureNew,
+        .textureDup = f_platform_api_software__textureDup,
+        .textureFree = f_platform_api_bands__textureFree,
+        .textureUpdate = f_platform_api_bands__textureUpdate,
+        .textureBlit = f_platform_api_bands__textureBlit,
+        .textureBlitEx = f_platform_api_bands__textureBlitEx,
+    #elif F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
         .textureNew = f_platform_api_software__textureNew,
         .textureDup = f_platform_api_software__textureDup,
         .textureFree = f_platform_api_software__textureFree,
@@ -220,6 +279,8 @@ static const FPlatformApi f__platform_api = {
         .textureBlit = f_platform_api_sdl__textureBlit,
         .textureBlitEx = f_platform_api_sdl__textureBlitEx,
         .textureSpriteToScreen = f_platform_api_sdl__textureSpriteToScreen,
+        .texturePageNew = f_platform_api_sdl__texturePageNew,
+        .texturePageSub = f_platform_api_sdl__texturePageSub,
     #endif
 
     #if F_CONFIG_LIB_PNG
@@ -311,6 +372,11 @@ static const FPlatformApi f__platform_api = {
         .malloc = f_platform_api_odroidgo__malloc,
         .mallocz = f_platform_api_odroidgo__mallocz,
     #endif
+
+    #if F_CONFIG_LIB_PTHREAD
+        .workRun = f_platform_api_pthread__workRun,
+        .workThreadsGet = f_platform_api_pthread__workThreadsGet,
+    #endif
 };
 
 void f_platform_api__customExit(int Status)
@@ -511,6 +577,19 @@ void f_platform_api__drawPixel(int X, int Y)
     f__platform_api.drawPixel(X, Y);
 }
 
+void f_platform_api__drawPixels(const FVecInt* Points, unsigned Num)
+{
+    if(f__platform_api.drawPixels == NULL) {
+        for(unsigned i = 0; i < Num; i++) {
+            f_platform_api__drawPixel(Points[i].x, Points[i].y);
+        }
+
+        return;
+    }
+
+    f__platform_api.drawPixels(Points, Num);
+}
+
 void f_platform_api__drawLine(int X1, int Y1, int X2, int Y2)
 {
     if(f__platform_api.drawLine == NULL) {
@@ -520,6 +599,20 @@ void f_platform_api__drawLine(int X1, int Y1, int X2, int Y2)
     f__platform_api.drawLine(X1, Y1, X2, Y2);
 }
 
+void f_platform_api__drawLines(const FVecInt* Points, unsigned Num)
+{
+    if(f__platform_api.drawLines == NULL) {
+        for(unsigned i = 0; i < Num; i++, Points += 2) {
+            f_platform_api__drawLine(
+                Points[0].x, Points[0].y, Points[1].x, Points[1].y);
+        }
+
+        return;
+    }
+
+    f__platform_api.drawLines(Points, Num);
+}
+
 void f_platform_api__drawLineH(int X1, int X2, int Y)
 {
     if(f__platform_api.drawLineH == NULL) {
@@ -556,6 +649,34 @@ void f_platform_api__drawRectangleOutline(int X, int Y, int Width, int Height)
     f__platform_api.drawRectangleOutline(X, Y, Width, Height);
 }
 
+void f_platform_api__drawRectanglesFilled(const FVecInt* Rects, unsigned Num)
+{
+    if(f__platform_api.drawRectanglesFilled == NULL) {
+        for(unsigned i = 0; i < Num; i++, Rects += 2) {
+            f_platform_api__drawRectangleFilled(
+                Rects[0].x, Rects[0].y, Rects[1].x, Rects[1].y);
+        }
+
+        return;
+    }
+
+    f__platform_api.drawRectanglesFilled(Rects, Num);
+}
+
+void f_platform_api__drawRectanglesOutline(const FVecInt* Rects, unsigned Num)
+{
+    if(f__platform_api.drawRectanglesOutline == NULL) {
+        for(unsigned i = 0; i < Num; i++, Rects += 2) {
+            f_platform_api__drawRectangleOutline(
+                Rects[0].x, Rects[0].y, Rects[1].x, Rects[1].y);
+        }
+
+        return;
+    }
+
+    f__platform_api.drawRectanglesOutline(Rects, Num);
+}
+
 void f_platform_api__drawCircleOutline(int X, int Y, int Radius)
 {
     if(f__platform_api.drawCircleOutline == NULL) {
@@ -637,6 +758,24 @@ void f_platform_api__textureBlitEx(const FPlatformTexture* Texture, const FPixel
     f__platform_api.textureBlitEx(Texture, Pixels, Frame, X, Y, Scale, Angle, CenterX, CenterY);
 }
 
+FPlatformTexture* f_platform_api__texturePageNew(const FPixels* Pixels)
+{
+    if(f__platform_api.texturePageNew == NULL) {
+        return NULL;
+    }
+
+    return f__platform_api.texturePageNew(Pixels);
+}
+
+FPlatformTexture* f_platform_api__texturePageSub(FPlatformTexture* Page, int X, int Y, int Width, int Height)
+{
+    if(f__platform_api.texturePageSub == NULL) {
+        return NULL;
+    }
+
+    return f__platform_api.texturePageSub(Page, X, Y, Width, Height);
+}
+
 FPixels* f_platform_api__imageRead(const char* Path)
 {
     if(f__platform_api.imageRead == NULL) {
@@ -1041,3 +1180,25 @@ void* f_platform_api__mallocz(size_t Size)
 
     return f__platform_api.mallocz(Size);
 }
+
+void f_platform_api__workRun(FCallWork* Function, void* Context, unsigned Num)
+{
+    if(f__platform_api.workRun == NULL) {
+        for(unsigned i = 0; i < Num; i++) {
+            Function(Context, i);
+        }
+
+        return;
+    }
+
+    f__platform_api.workRun(Function, Context, Num);
+}
+
+unsigned f_platform_api__workThreadsGet(void)
+{
+    if(f__platform_api.workThreadsGet == NULL) {
+        return 1;
+    }
+
+    return f__platform_api.workThreadsGet();
+}
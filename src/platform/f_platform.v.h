@@ -39,6 +39,7 @@ typedef void FPlatformFile;
 #include "../input/f_analog.v.h"
 #include "../input/f_button.v.h"
 #include "../math/f_fix.v.h"
+#include "../math/f_vec.v.h"
 #include "../sound/f_sample.v.h"
 
 typedef void FCallApi_CustomExit(int Status);
@@ -64,11 +65,15 @@ typedef void FCallApi_ScreenToTexture(FPlatformTextureScreen* Texture, unsigned
 typedef void FCallApi_ScreenClipSet(void);
 
 typedef void FCallApi_DrawPixel(int X, int Y);
+typedef void FCallApi_DrawPixels(const FVecInt* Points, unsigned Num);
 typedef void FCallApi_DrawLine(int X1, int Y1, int X2, int Y2);
+typedef void FCallApi_DrawLines(const FVecInt* Points, unsigned Num);
 typedef void FCallApi_DrawLineH(int X1, int X2, int Y);
 typedef void FCallApi_DrawLineV(int X, int Y1, int Y2);
 typedef void FCallApi_DrawRectangleFilled(int X, int Y, int Width, int Height);
 typedef void FCallApi_DrawRectangleOutline(int X, int Y, int Width, int Height);
+typedef void FCallApi_DrawRectanglesFilled(const FVecInt* Rects, unsigned Num);
+typedef void FCallApi_DrawRectanglesOutline(const FVecInt* Rects, unsigned Num);
 typedef void FCallApi_DrawCircleOutline(int X, int Y, int Radius);
 typedef void FCallApi_DrawCircleFilled(int X, int Y, int Radius);
 typedef void FCallApi_DrawSetColor(void);
@@ -81,6 +86,8 @@ typedef void FCallApi_TextureUpdate(FPlatformTexture* Texture, const FPixels* Pi
 typedef void FCallApi_TextureBlit(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y);
 typedef void FCallApi_TextureBlitEx(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y, FFix Scale, unsigned Angle, FFix CenterX, FFix CenterY);
 typedef FPlatformTextureScreen* FCallApi_TextureSpriteToScreen(FPlatformTexture* SpriteTexture);
+typedef FPlatformTexture* FCallApi_TexturePageNew(const FPixels* Pixels);
+typedef FPlatformTexture* FCallApi_TexturePageSub(FPlatformTexture* Page, int X, int Y, int Width, int Height);
 
 typedef FPixels* FCallApi_ImageRead(const char* Path);
 typedef void FCallApi_ImageWrite(const char* Path, const FPixels* Pixels, unsigned Frame, char* Title, char* Description);
@@ -133,6 +140,10 @@ typedef void FCallApi_FileSync(void);
 typedef void* FCallApi_Malloc(size_t Size);
 typedef void* FCallApi_Mallocz(size_t Size);
 
+typedef void FCallWork(void* Context, unsigned Index);
+typedef void FCallApi_WorkRun(FCallWork* Function, void* Context, unsigned Num);
+typedef unsigned FCallApi_WorkThreadsGet(void);
+
 typedef struct FPlatformApi {
     FCallApi_CustomExit* customExit;
 
@@ -157,11 +168,15 @@ typedef struct FPlatformApi {
     FCallApi_ScreenClipSet* screenClipSet;
 
     FCallApi_DrawPixel* drawPixel;
+    FCallApi_DrawPixels* drawPixels;
     FCallApi_DrawLine* drawLine;
+    FCallApi_DrawLines* drawLines;
     FCallApi_DrawLineH* drawLineH;
     FCallApi_DrawLineV* drawLineV;
     FCallApi_DrawRectangleOutline* drawRectangleOutline;
     FCallApi_DrawRectangleFilled* drawRectangleFilled;
+    FCallApi_DrawRectanglesOutline* drawRectanglesOutline;
+    FCallApi_DrawRectanglesFilled* drawRectanglesFilled;
     FCallApi_DrawCircleOutline* drawCircleOutline;
     FCallApi_DrawCircleFilled* drawCircleFilled;
     FCallApi_DrawSetColor* drawSetColor;
@@ -174,6 +189,8 @@ typedef struct FPlatformApi {
     FCallApi_TextureBlit* textureBlit;
     FCallApi_TextureBlitEx* textureBlitEx;
     FCallApi_TextureSpriteToScreen* textureSpriteToScreen;
+    FCallApi_TexturePageNew* texturePageNew;
+    FCallApi_TexturePageSub* texturePageSub;
 
     FCallApi_ImageRead* imageRead;
     FCallApi_ImageWrite* imageWrite;
@@ -231,6 +248,9 @@ typedef struct FPlatformApi {
 
     FCallApi_Malloc* malloc;
     FCallApi_Mallocz* mallocz;
+
+    FCallApi_WorkRun* workRun;
+    FCallApi_WorkThreadsGet* workThreadsGet;
 } FPlatformApi;
 
 extern const FPack f_pack__platform;
@@ -260,11 +280,15 @@ extern void f_platform_api__screenFullscreenFlip(void);
 extern void f_platform_api__drawSetColor(void);
 extern void f_platform_api__drawSetBlend(void);
 extern void f_platform_api__drawPixel(int X, int Y);
+extern void f_platform_api__drawPixels(const FVecInt* Points, unsigned Num);
 extern void f_platform_api__drawLine(int X1, int Y1, int X2, int Y2);
+extern void f_platform_api__drawLines(const FVecInt* Points, unsigned Num);
 extern void f_platform_api__drawLineH(int X1, int X2, int Y);
 extern void f_platform_api__drawLineV(int X, int Y1, int Y2);
 extern void f_platform_api__drawRectangleFilled(int X, int Y, int Width, int Height);
 extern void f_platform_api__drawRectangleOutline(int X, int Y, int Width, int Height);
+extern void f_platform_api__drawRectanglesFilled(const FVecInt* Rects, unsigned Num);
+extern void f_platform_api__drawRectanglesOutline(const FVecInt* Rects, unsigned Num);
 extern void f_platform_api__drawCircleOutline(int X, int Y, int Radius);
 extern void f_platform_api__drawCircleFilled(int X, int Y, int Radius);
 
@@ -275,6 +299,8 @@ extern void f_platform_api__textureFree(FPlatformTexture* Texture);
 extern void f_platform_api__textureUpdate(FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame);
 extern void f_platform_api__textureBlit(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y);
 extern void f_platform_api__textureBlitEx(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y, FFix Scale, unsigned Angle, FFix CenterX, FFix CenterY);
+extern FPlatformTexture* f_platform_api__texturePageNew(const FPixels* Pixels);
+extern FPlatformTexture* f_platform_api__texturePageSub(FPlatformTexture* Page, int X, int Y, int Width, int Height);
 
 extern FPixels* f_platform_api__imageRead(const char* Path);
 extern void f_platform_api__imageWrite(const char* Path, const FPixels* Pixels, unsigned Frame, char* Title, char* Description);
@@ -332,4 +358,7 @@ extern int f_platform_api__fileReadCharUndo(FPlatformFile* File, int Char);
 extern void* f_platform_api__malloc(size_t Size);
 extern void* f_platform_api__mallocz(size_t Size);
 
+extern void f_platform_api__workRun(FCallWork* Function, void* Context, unsigned Num);
+extern unsigned f_platform_api__workThreadsGet(void);
+
 #endif // F_INC_PLATFORM_PLATFORM_V_H
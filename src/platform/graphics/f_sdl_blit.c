@@ -18,6 +18,9 @@
 #include "f_sdl_blit.v.h"
 #include <faur.v.h>
 
+#include "../../graphics/f_pixels_vec.v.h"
+#include "f_sdl_queue.v.h"
+
 #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
 #include <SDL2/SDL.h>
 
@@ -29,90 +32,163 @@ typedef enum {
     F_SIDE__NUM
 } FTextureSide;
 
-typedef struct {
+typedef struct FTextureSDL FTextureSDL;
+
+struct FTextureSDL {
     SDL_Texture* sides[F_SIDE__NUM];
-} FTextureSDL;
+    const FPixels* pixels; // atlas pages build sides from their own pixels
+    const FTextureSDL* page; // atlas sprites blit from an area of this page
+    FVecInt pageStart;
+};
 
 extern SDL_Renderer* f__sdlRenderer;
 
+unsigned f_platform_sdl_blit__sidesNum;
+
 FPlatformTextureScreen* f_platform_api_sdl__textureSpriteToScreen(FPlatformTexture* SpriteTexture)
 {
-    return ((FTextureSDL*)SpriteTexture)->sides[F_SIDE__NORMAL];
+    const FTextureSDL* texture = SpriteTexture;
+
+    if(texture->page) {
+        F__FATAL("Cannot draw on atlas sprites");
+    }
+
+    return texture->sides[F_SIDE__NORMAL];
 }
 
-FPlatformTexture* f_platform_api_sdl__textureNew(const FPixels* Pixels)
+// Set Bits on the pixels that are the color key, or on the ones that are not
+static void sideBitsSet(FColorPixel* Buffer, const FColorPixel* Original, unsigned Len, FColorPixel Bits, bool OnKey)
 {
-    FTextureSDL* texture = f_mem_mallocz(sizeof(FTextureSDL));
+    const int len = (int)Len;
 
-    unsigned totalBufferLen = Pixels->bufferLen * Pixels->framesNum;
-    unsigned totalBufferSize = Pixels->bufferSize * Pixels->framesNum;
+    #if F_PIXELS_VEC__SIMD
+        const FVecPixels key = f_pixels_vec__splat(f_color__key);
+        const FVecPixels bits = f_pixels_vec__splat(Bits);
 
-    const FColorPixel* original = f_pixels__bufferGetStartConst(Pixels, 0);
-    FColorPixel* buffer = f_mem_dup(original, totalBufferSize);
+        for(int i = 0; i < F_PIXELS_VEC__DONE(len); i += F_PIXELS_VEC__LANES) {
+            FVecPixels mask =
+                f_pixels_vec__equal(f_pixels_vec__load(Original + i), key);
 
-    for(int s = 0; s < F_SIDE__NUM; s++) {
-        switch(s) {
-            case F_SIDE__NORMAL: {
-                for(unsigned i = totalBufferLen; i--; ) {
-                    if(original[i] != f_color__key) {
-                        // Set full alpha for non-transparent pixel
-                        buffer[i] |=
-                            (FColorPixel)
-                                (((1u << F__PX_BITS_A) - 1u) << F__PX_SHIFT_A);
-                    }
-                }
-            } break;
-
-            case F_SIDE__COLORMOD_BITMAP: {
-                for(unsigned i = totalBufferLen; i--; ) {
-                    if(original[i] == f_color__key) {
-                        // Set full color for transparent pixel
-                        buffer[i] |= f_color_pixelFromHex(0xffffff);
-                    }
-                }
-            } break;
-
-            case F_SIDE__COLORMOD_FLAT: {
-                for(unsigned i = totalBufferLen; i--; ) {
-                    if(original[i] != f_color__key) {
-                        // Set full color for non-transparent pixel
-                        buffer[i] |= f_color_pixelFromHex(0xffffff);
-                    }
-                }
-            } break;
-
-            case F_SIDE__ALPHA_MASK: {
-                for(unsigned i = totalBufferLen; i--; ) {
-                    int alpha = f_color_pixelToRgbAny(original[i]);
-
-                    buffer[i] =
-                        (FColorPixel)
-                            (original[i] | ((unsigned)alpha << F__PX_SHIFT_A));
-                }
-            } break;
-        }
+            if(!OnKey) {
+                mask = ~mask;
+            }
 
-        SDL_Texture* tex = SDL_CreateTexture(
-                            f__sdlRenderer,
-                            F_SDL__PIXEL_FORMAT,
-                            SDL_TEXTUREACCESS_TARGET,
-                            Pixels->size.x,
-                            Pixels->size.y * (int)Pixels->framesNum);
+            f_pixels_vec__store(
+                Buffer + i, f_pixels_vec__load(Buffer + i) | (bits & mask));
+        }
+    #endif
 
-        if(tex == NULL) {
-            F__FATAL("SDL_CreateTexture: %s", SDL_GetError());
+    for(int i = F_PIXELS_VEC__DONE(len); i < len; i++) {
+        if((Original[i] == f_color__key) == OnKey) {
+            Buffer[i] |= Bits;
         }
+    }
+}
 
-        if(SDL_UpdateTexture(
-            tex, NULL, buffer, Pixels->size.x * (int)sizeof(FColorPixel)) < 0) {
+static void sideConvert(FColorPixel* Buffer, const FColorPixel* Original, unsigned Len, FTextureSide Side)
+{
+    switch(Side) {
+        case F_SIDE__NORMAL: {
+            // Set full alpha for non-transparent pixels
+            sideBitsSet(Buffer,
+                        Original,
+                        Len,
+                        (FColorPixel)
+                            (((1u << F__PX_BITS_A) - 1u) << F__PX_SHIFT_A),
+                        false);
+        } break;
+
+        case F_SIDE__COLORMOD_BITMAP: {
+            // Set full color for transparent pixels
+            sideBitsSet(
+                Buffer, Original, Len, f_color_pixelFromHex(0xffffff), true);
+        } break;
+
+        case F_SIDE__COLORMOD_FLAT: {
+            // Set full color for non-transparent pixels
+            sideBitsSet(
+                Buffer, Original, Len, f_color_pixelFromHex(0xffffff), false);
+        } break;
+
+        case F_SIDE__ALPHA_MASK: {
+            for(unsigned i = Len; i--; ) {
+                int alpha = f_color_pixelToRgbAny(Original[i]);
+
+                Buffer[i] =
+                    (FColorPixel)
+                        (Original[i] | ((unsigned)alpha << F__PX_SHIFT_A));
+            }
+        } break;
+
+        case F_SIDE__NUM: break;
+    }
+}
 
-            F__FATAL("SDL_UpdateTexture: %s", SDL_GetError());
-        }
+static SDL_Texture* sideNew(const FPixels* Pixels, FTextureSide Side)
+{
+    unsigned totalBufferLen = Pixels->bufferLen * Pixels->framesNum;
+    unsigned totalBufferSize =
+        totalBufferLen * (unsigned)sizeof(FColorPixel);
+
+    FColorPixel* expanded = NULL;
+    const FColorPixel* original;
 
-        texture->sides[s] = tex;
+    if(f_pixels__isIndexed(Pixels)) {
+        // Textures hold native pixels, looked up once through the lut
+        expanded = f_mem_malloc(totalBufferSize);
+        f_pixels__indexedExpand(Pixels, expanded);
+        original = expanded;
+    } else {
+        original = f_pixels__bufferGetStartConst(Pixels, 0);
+    }
+
+    FColorPixel* buffer = f_mem_dup(original, totalBufferSize);
+
+    sideConvert(buffer, original, totalBufferLen, Side);
+
+    SDL_Texture* tex = SDL_CreateTexture(
+                        f__sdlRenderer,
+                        F_SDL__PIXEL_FORMAT,
+                        SDL_TEXTUREACCESS_TARGET,
+                        Pixels->size.x,
+                        Pixels->size.y * (int)Pixels->framesNum);
+
+    if(tex == NULL) {
+        F__FATAL("SDL_CreateTexture: %s", SDL_GetError());
+    }
+
+    if(SDL_UpdateTexture(
+        tex, NULL, buffer, Pixels->size.x * (int)sizeof(FColorPixel)) < 0) {
+
+        F__FATAL("SDL_UpdateTexture: %s", SDL_GetError());
     }
 
     f_mem_free(buffer);
+    f_mem_free(expanded);
+
+    f_platform_sdl_blit__sidesNum++;
+
+    return tex;
+}
+
+// The non-normal sides are only built the first time a blit mode needs them
+static SDL_Texture* sideGet(const FTextureSDL* Texture, const FPixels* Pixels, FTextureSide Side)
+{
+    FTextureSDL* texture = (FTextureSDL*)Texture;
+
+    if(texture->sides[Side] == NULL) {
+        texture->sides[Side] = sideNew(Pixels, Side);
+    }
+
+    return texture->sides[Side];
+}
+
+FPlatformTexture* f_platform_api_sdl__textureNew(const FPixels* Pixels)
+{
+    FTextureSDL* texture = f_mem_mallocz(sizeof(FTextureSDL));
+
+    // Also the render target when drawing to the sprite
+    texture->sides[F_SIDE__NORMAL] = sideNew(Pixels, F_SIDE__NORMAL);
 
     return texture;
 }
@@ -120,13 +196,27 @@ FPlatformTexture* f_platform_api_sdl__textureNew(const FPixels* Pixels)
 FPlatformTexture* f_platform_api_sdl__textureDup(const FPlatformTexture* Texture, const FPixels* Pixels)
 {
     const FTextureSDL* texSrc = Texture;
+
+    if(texSrc->page) {
+        return f_platform_api_sdl__textureNew(Pixels);
+    }
+
     FTextureSDL* texDst = f_mem_mallocz(sizeof(FTextureSDL));
 
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        // Queued draws target the current screen texture
+        f_platform_sdl_queue__flush();
+    #endif
+
     if(SDL_RenderSetClipRect(f__sdlRenderer, NULL) < 0) {
         f_out__error("SDL_RenderSetClipRect: %s", SDL_GetError());
     }
 
     for(int s = 0; s < F_SIDE__NUM; s++) {
+        if(texSrc->sides[s] == NULL) {
+            continue;
+        }
+
         SDL_Texture* tex = SDL_CreateTexture(
                             f__sdlRenderer,
                             F_SDL__PIXEL_FORMAT,
@@ -151,6 +241,7 @@ FPlatformTexture* f_platform_api_sdl__textureDup(const FPlatformTexture* Texture
         }
 
         texDst->sides[s] = tex;
+        f_platform_sdl_blit__sidesNum++;
     }
 
     // Restore user settings
@@ -172,15 +263,77 @@ void f_platform_api_sdl__textureFree(FPlatformTexture* Texture)
 
     FTextureSDL* texture = Texture;
 
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        // Queued draws may still reference this texture
+        f_platform_sdl_queue__flush();
+    #endif
+
     for(int s = F_SIDE__NUM; s--; ) {
         if(texture->sides[s]) {
             SDL_DestroyTexture(texture->sides[s]);
+            f_platform_sdl_blit__sidesNum--;
         }
     }
 
     f_mem_free(texture);
 }
 
+FPlatformTexture* f_platform_api_sdl__texturePageNew(const FPixels* Pixels)
+{
+    FTextureSDL* texture = f_mem_mallocz(sizeof(FTextureSDL));
+
+    // Sides are built on first blit, after sprites were added to the page
+    texture->pixels = Pixels;
+
+    return texture;
+}
+
+FPlatformTexture* f_platform_api_sdl__texturePageSub(FPlatformTexture* Page, int X, int Y, int Width, int Height)
+{
+    FTextureSDL* page = Page;
+    FTextureSDL* texture = f_mem_mallocz(sizeof(FTextureSDL));
+
+    texture->page = page;
+    texture->pageStart = (FVecInt){X, Y};
+
+    FColorPixel* buffer = NULL;
+    SDL_Rect area = {X, Y, Width, Height};
+    unsigned len = (unsigned)(Width * Height);
+
+    for(int s = 0; s < F_SIDE__NUM; s++) {
+        if(page->sides[s] == NULL) {
+            continue;
+        }
+
+        if(buffer == NULL) {
+            buffer = f_mem_malloc(len * sizeof(FColorPixel));
+        }
+
+        const FColorPixel* original =
+            f_pixels__bufferGetFromConst(page->pixels, 0, X, Y);
+
+        for(int y = 0; y < Height; y++) {
+            memcpy(buffer + y * Width,
+                   original + y * page->pixels->size.x,
+                   (unsigned)Width * sizeof(FColorPixel));
+        }
+
+        sideConvert(buffer, buffer, len, (FTextureSide)s);
+
+        if(SDL_UpdateTexture(page->sides[s],
+                             &area,
+                             buffer,
+                             Width * (int)sizeof(FColorPixel)) < 0) {
+
+            F__FATAL("SDL_UpdateTexture: %s", SDL_GetError());
+        }
+    }
+
+    f_mem_free(buffer);
+
+    return texture;
+}
+
 void f_platform_api_sdl__textureBlit(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y)
 {
     f_platform_api__textureBlitEx(Texture,
@@ -201,37 +354,21 @@ void f_platform_api_sdl__textureBlitEx(const FPlatformTexture* Texture, const FP
         (SDL_BlendMode)f_platform_sdl_video__pixelBlendToSdlBlend();
 
     const FTextureSDL* texture = Texture;
+    const FTextureSDL* owner = texture->page ? texture->page : texture;
+    const FPixels* pixels = owner->pixels ? owner->pixels : Pixels;
 
     if(f__color.fillBlit) {
-        tex = texture->sides[F_SIDE__COLORMOD_FLAT];
+        tex = sideGet(owner, pixels, F_SIDE__COLORMOD_FLAT);
     } else if(blend == SDL_BLENDMODE_MOD) {
-        tex = texture->sides[F_SIDE__COLORMOD_BITMAP];
+        tex = sideGet(owner, pixels, F_SIDE__COLORMOD_BITMAP);
     } else if(f__color.blend == F_COLOR_BLEND_ALPHA_MASK) {
-        tex = texture->sides[F_SIDE__ALPHA_MASK];
+        tex = sideGet(owner, pixels, F_SIDE__ALPHA_MASK);
     } else {
-        tex = texture->sides[F_SIDE__NORMAL];
-    }
-
-    if(SDL_SetTextureBlendMode(tex, blend) < 0) {
-        f_out__error("SDL_SetTextureBlendMode: %s", SDL_GetError());
-    }
-
-    if(SDL_SetTextureAlphaMod(
-        tex, f_platform_sdl_video__pixelAlphaToSdlAlpha()) < 0) {
-
-        f_out__error("SDL_SetTextureAlphaMod: %s", SDL_GetError());
+        tex = sideGet(owner, pixels, F_SIDE__NORMAL);
     }
 
     bool mod = f__color.fillBlit || f__color.blend == F_COLOR_BLEND_ALPHA_MASK;
 
-    if(mod && SDL_SetTextureColorMod(tex,
-                                     (uint8_t)f__color.rgb.r,
-                                     (uint8_t)f__color.rgb.g,
-                                     (uint8_t)f__color.rgb.b) < 0) {
-
-        f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
-    }
-
     Y += f__screen.yOffset;
 
     FVecInt halfSize = {Pixels->size.x / 2, Pixels->size.y / 2};
@@ -243,8 +380,8 @@ void f_platform_api_sdl__textureBlitEx(const FPlatformTexture* Texture, const FP
             f_fix_mul(f_fix_fromInt(halfSize.y) + CenterY * halfSize.y, Scale))
     };
 
-    SDL_Rect src = {0,
-                    Pixels->size.y * (int)Frame,
+    SDL_Rect src = {texture->pageStart.x,
+                    texture->pageStart.y + Pixels->size.y * (int)Frame,
                     Pixels->size.x,
                     Pixels->size.y};
 
@@ -253,19 +390,51 @@ void f_platform_api_sdl__textureBlitEx(const FPlatformTexture* Texture, const FP
                      f_fix_toInt(Pixels->size.x * Scale),
                      f_fix_toInt(Pixels->size.y * Scale)};
 
-    if(SDL_RenderCopyEx(f__sdlRenderer,
-                        tex,
-                        &src,
-                        &dest,
-                        360 - 360 * Angle / F_FIX_ANGLES_NUM,
-                        &center,
-                        SDL_FLIP_NONE) < 0) {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__addTexture(
+            tex,
+            (FVecInt){pixels->size.x,
+                      pixels->size.y * (int)pixels->framesNum},
+            (FVecInt){src.x, src.y},
+            (FVecInt){src.w, src.h},
+            (FVecInt){dest.x, dest.y},
+            (FVecInt){dest.w, dest.h},
+            (FVecInt){center.x, center.y},
+            360 - 360 * Angle / F_FIX_ANGLES_NUM,
+            mod);
+    #else
+        if(SDL_SetTextureBlendMode(tex, blend) < 0) {
+            f_out__error("SDL_SetTextureBlendMode: %s", SDL_GetError());
+        }
 
-        f_out__error("SDL_RenderCopyEx: %s", SDL_GetError());
-    }
+        if(SDL_SetTextureAlphaMod(
+            tex, f_platform_sdl_video__pixelAlphaToSdlAlpha()) < 0) {
 
-    if(mod && SDL_SetTextureColorMod(tex, 0xff, 0xff, 0xff) < 0) {
-        f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
-    }
+            f_out__error("SDL_SetTextureAlphaMod: %s", SDL_GetError());
+        }
+
+        if(mod && SDL_SetTextureColorMod(tex,
+                                         (uint8_t)f__color.rgb.r,
+                                         (uint8_t)f__color.rgb.g,
+                                         (uint8_t)f__color.rgb.b) < 0) {
+
+            f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
+        }
+
+        if(SDL_RenderCopyEx(f__sdlRenderer,
+                            tex,
+                            &src,
+                            &dest,
+                            360 - 360 * Angle / F_FIX_ANGLES_NUM,
+                            &center,
+                            SDL_FLIP_NONE) < 0) {
+
+            f_out__error("SDL_RenderCopyEx: %s", SDL_GetError());
+        }
+
+        if(mod && SDL_SetTextureColorMod(tex, 0xff, 0xff, 0xff) < 0) {
+            f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
+        }
+    #endif
 }
 #endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
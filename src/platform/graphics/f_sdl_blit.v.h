@@ -22,6 +22,8 @@
 
 #include "../f_platform.v.h"
 
+extern unsigned f_platform_sdl_blit__sidesNum; // Live SDL textures, all sprites
+
 extern FPlatformTextureScreen* f_platform_api_sdl__textureSpriteToScreen(FPlatformTexture* SpriteTexture);
 
 extern FCallApi_TextureNew f_platform_api_sdl__textureNew;
@@ -31,4 +33,7 @@ extern FCallApi_TextureFree f_platform_api_sdl__textureFree;
 extern FCallApi_TextureBlit f_platform_api_sdl__textureBlit;
 extern FCallApi_TextureBlitEx f_platform_api_sdl__textureBlitEx;
 
+extern FCallApi_TexturePageNew f_platform_api_sdl__texturePageNew;
+extern FCallApi_TexturePageSub f_platform_api_sdl__texturePageSub;
+
 #endif // F_INC_PLATFORM_GRAPHICS_SDL_BLIT_V_H
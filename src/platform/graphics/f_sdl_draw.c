@@ -18,11 +18,16 @@
 #include "f_sdl_draw.v.h"
 #include <faur.v.h>
 
+#include "f_sdl_queue.v.h"
+
 #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
 #include <SDL2/SDL.h>
 
 extern SDL_Renderer* f__sdlRenderer;
 
+// Batched draws go to SDL in chunks of this many points or rects
+#define F__BATCH_NUM 64
+
 void f_platform_api_sdl__drawSetColor(void)
 {
     if(SDL_SetRenderDrawColor(
@@ -50,9 +55,41 @@ void f_platform_api_sdl__drawPixel(int X, int Y)
 {
     Y += f__screen.yOffset;
 
-    if(SDL_RenderDrawPoint(f__sdlRenderer, X, Y) < 0) {
-        f_out__error("SDL_RenderDrawPoint: %s", SDL_GetError());
-    }
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__addRect(X, Y, 1, 1);
+    #else
+        if(SDL_RenderDrawPoint(f__sdlRenderer, X, Y) < 0) {
+            f_out__error("SDL_RenderDrawPoint: %s", SDL_GetError());
+        }
+    #endif
+}
+
+void f_platform_api_sdl__drawPixels(const FVecInt* Points, unsigned Num)
+{
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        for(unsigned i = 0; i < Num; i++) {
+            f_platform_sdl_queue__addRect(
+                Points[i].x, Points[i].y + f__screen.yOffset, 1, 1);
+        }
+    #else
+        SDL_Point points[F__BATCH_NUM];
+
+        while(Num > 0) {
+            const unsigned n = f_math_minu(Num, F__BATCH_NUM);
+
+            for(unsigned i = 0; i < n; i++) {
+                points[i].x = Points[i].x;
+                points[i].y = Points[i].y + f__screen.yOffset;
+            }
+
+            if(SDL_RenderDrawPoints(f__sdlRenderer, points, (int)n) < 0) {
+                f_out__error("SDL_RenderDrawPoints: %s", SDL_GetError());
+            }
+
+            Points += n;
+            Num -= n;
+        }
+    #endif
 }
 
 void f_platform_api_sdl__drawLine(int X1, int Y1, int X2, int Y2)
@@ -60,8 +97,21 @@ void f_platform_api_sdl__drawLine(int X1, int Y1, int X2, int Y2)
     Y1 += f__screen.yOffset;
     Y2 += f__screen.yOffset;
 
-    if(SDL_RenderDrawLine(f__sdlRenderer, X1, Y1, X2, Y2) < 0) {
-        f_out__error("SDL_RenderDrawLine: %s", SDL_GetError());
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__addLine(X1, Y1, X2, Y2);
+    #else
+        if(SDL_RenderDrawLine(f__sdlRenderer, X1, Y1, X2, Y2) < 0) {
+            f_out__error("SDL_RenderDrawLine: %s", SDL_GetError());
+        }
+    #endif
+}
+
+void f_platform_api_sdl__drawLines(const FVecInt* Points, unsigned Num)
+{
+    // Line pairs do not map to SDL_RenderDrawLines, which draws a polyline
+    for(unsigned i = Num; i--; Points += 2) {
+        f_platform_api_sdl__drawLine(
+            Points[0].x, Points[0].y, Points[1].x, Points[1].y);
     }
 }
 
@@ -102,11 +152,109 @@ void f_platform_api_sdl__drawRectangleFilled(int X, int Y, int Width, int Height
 {
     Y += f__screen.yOffset;
 
-    SDL_Rect area = {X, Y, Width, Height};
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__addRect(X, Y, Width, Height);
+    #else
+        SDL_Rect area = {X, Y, Width, Height};
 
-    if(SDL_RenderFillRect(f__sdlRenderer, &area) < 0) {
-        f_out__error("SDL_RenderFillRect: %s", SDL_GetError());
+        if(SDL_RenderFillRect(f__sdlRenderer, &area) < 0) {
+            f_out__error("SDL_RenderFillRect: %s", SDL_GetError());
+        }
+    #endif
+}
+
+#if !F_CONFIG_SCREEN_RENDER_QUEUE
+typedef struct {
+    SDL_Rect rects[F__BATCH_NUM];
+    int num;
+} FSdlRects;
+
+static void rectsFlush(FSdlRects* Rects)
+{
+    if(SDL_RenderFillRects(f__sdlRenderer, Rects->rects, Rects->num) < 0) {
+        f_out__error("SDL_RenderFillRects: %s", SDL_GetError());
     }
+
+    Rects->num = 0;
+}
+#endif
+
+static inline void rectsAdd(void* Rects, int X, int Y, int Width, int Height)
+{
+    Y += f__screen.yOffset;
+
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        F_UNUSED(Rects);
+
+        f_platform_sdl_queue__addRect(X, Y, Width, Height);
+    #else
+        FSdlRects* rects = Rects;
+
+        if(rects->num == F__BATCH_NUM) {
+            rectsFlush(rects);
+        }
+
+        rects->rects[rects->num++] = (SDL_Rect){X, Y, Width, Height};
+    #endif
+}
+
+void f_platform_api_sdl__drawRectanglesOutline(const FVecInt* Rects, unsigned Num)
+{
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        void* rects = NULL;
+    #else
+        FSdlRects buffer = {.num = 0};
+        void* rects = &buffer;
+    #endif
+
+    // Same four edges as drawRectangleOutline, per rectangle
+    for(unsigned i = Num; i--; Rects += 2) {
+        const int x = Rects[0].x;
+        const int y = Rects[0].y;
+        const int w = Rects[1].x;
+        const int h = Rects[1].y;
+
+        rectsAdd(rects, x, y, w, 1);
+
+        if(h <= 1) {
+            continue;
+        }
+
+        rectsAdd(rects, x, y + h - 1, w, 1);
+
+        if(w <= 1 || h <= 2) {
+            continue;
+        }
+
+        rectsAdd(rects, x, y + 1, 1, h - 2);
+        rectsAdd(rects, x + w - 1, y + 1, 1, h - 2);
+    }
+
+    #if !F_CONFIG_SCREEN_RENDER_QUEUE
+        if(buffer.num > 0) {
+            rectsFlush(&buffer);
+        }
+    #endif
+}
+
+void f_platform_api_sdl__drawRectanglesFilled(const FVecInt* Rects, unsigned Num)
+{
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        void* rects = NULL;
+    #else
+        FSdlRects buffer = {.num = 0};
+        void* rects = &buffer;
+    #endif
+
+    for(unsigned i = Num; i--; Rects += 2) {
+        rectsAdd(rects, Rects[0].x, Rects[0].y, Rects[1].x, Rects[1].y);
+    }
+
+    #if !F_CONFIG_SCREEN_RENDER_QUEUE
+        if(buffer.num > 0) {
+            rectsFlush(&buffer);
+        }
+    #endif
 }
 
 void f_platform_api_sdl__drawCircleOutline(int X, int Y, int Radius)
@@ -219,11 +367,20 @@ void f_platform_api_sdl__drawCircleOutline(int X, int Y, int Radius)
         scanlines[scanline4][1] = (SDL_Point){x4, y4};
     }
 
-    if(SDL_RenderDrawPoints(
-        f__sdlRenderer, (SDL_Point*)scanlines, numPointPairs * 4 * 2) < 0) {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        for(int i = 0; i < numPointPairs * 4; i++) {
+            f_platform_sdl_queue__addRect(
+                scanlines[i][0].x, scanlines[i][0].y, 1, 1);
+            f_platform_sdl_queue__addRect(
+                scanlines[i][1].x, scanlines[i][1].y, 1, 1);
+        }
+    #else
+        if(SDL_RenderDrawPoints(
+            f__sdlRenderer, (SDL_Point*)scanlines, numPointPairs * 4 * 2) < 0) {
 
-        f_out__error("SDL_RenderDrawPoints: %s", SDL_GetError());
-    }
+            f_out__error("SDL_RenderDrawPoints: %s", SDL_GetError());
+        }
+    #endif
 }
 
 void f_platform_api_sdl__drawCircleFilled(int X, int Y, int Radius)
@@ -299,10 +456,19 @@ void f_platform_api_sdl__drawCircleFilled(int X, int Y, int Radius)
         scanlines[scanline4] = (SDL_Rect){x3, y4, w3, 1};
     }
 
-    if(SDL_RenderFillRects(
-        f__sdlRenderer, scanlines, (int)F_ARRAY_LEN(scanlines)) < 0) {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        for(int i = 0; i < numScanlines; i++) {
+            f_platform_sdl_queue__addRect(scanlines[i].x,
+                                          scanlines[i].y,
+                                          scanlines[i].w,
+                                          1);
+        }
+    #else
+        if(SDL_RenderFillRects(
+            f__sdlRenderer, scanlines, (int)F_ARRAY_LEN(scanlines)) < 0) {
 
-        f_out__error("SDL_RenderFillRects: %s", SDL_GetError());
-    }
+            f_out__error("SDL_RenderFillRects: %s", SDL_GetError());
+        }
+    #endif
 }
 #endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
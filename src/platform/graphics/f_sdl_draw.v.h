@@ -26,11 +26,15 @@ extern FCallApi_DrawSetColor f_platform_api_sdl__drawSetColor;
 extern FCallApi_DrawSetBlend f_platform_api_sdl__drawSetBlend;
 
 extern FCallApi_DrawPixel f_platform_api_sdl__drawPixel;
+extern FCallApi_DrawPixels f_platform_api_sdl__drawPixels;
 extern FCallApi_DrawLine f_platform_api_sdl__drawLine;
+extern FCallApi_DrawLines f_platform_api_sdl__drawLines;
 extern FCallApi_DrawLineH f_platform_api_sdl__drawLineH;
 extern FCallApi_DrawLineV f_platform_api_sdl__drawLineV;
 extern FCallApi_DrawRectangleOutline f_platform_api_sdl__drawRectangleOutline;
 extern FCallApi_DrawRectangleFilled f_platform_api_sdl__drawRectangleFilled;
+extern FCallApi_DrawRectanglesOutline f_platform_api_sdl__drawRectanglesOutline;
+extern FCallApi_DrawRectanglesFilled f_platform_api_sdl__drawRectanglesFilled;
 extern FCallApi_DrawCircleOutline f_platform_api_sdl__drawCircleOutline;
 extern FCallApi_DrawCircleFilled f_platform_api_sdl__drawCircleFilled;
 
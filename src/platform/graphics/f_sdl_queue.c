@@ -0,0 +1,503 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_sdl_queue.v.h"
+#include <faur.v.h>
+
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2 && F_CONFIG_SCREEN_RENDER_QUEUE
+#include <SDL2/SDL.h>
+
+// Submit each batch as one SDL_RenderGeometry call when available
+#define F__GEOMETRY SDL_VERSION_ATLEAST(2, 0, 18)
+
+// Overlaps are tracked on a grid of 2^F__CELL_SHIFT pixel square cells
+#define F__CELL_SHIFT 5
+
+typedef enum {
+    F__CMD_QUAD, // textured or solid rectangle, optionally rotated
+    F__CMD_LINE,
+} FQueueCmdType;
+
+typedef struct {
+    SDL_Texture* texture;
+    SDL_BlendMode blend;
+    FQueueCmdType type;
+} FQueueKey;
+
+typedef struct {
+    FQueueKey key;
+    unsigned level;
+    unsigned seq;
+    SDL_Color color;
+    SDL_Rect src;
+    SDL_Rect dst; // F__CMD_LINE uses {x1, y1, x2, y2}
+    SDL_Point center;
+    double angle;
+    FVecInt textureSize;
+} FQueueCmd;
+
+typedef struct {
+    FQueueKey key; // Key of the commands on the top level
+    unsigned level; // Top level of the commands that touched this cell
+    bool used;
+    bool mixed; // Commands with different keys share the top level
+} FQueueCell;
+
+extern SDL_Renderer* f__sdlRenderer;
+
+static struct {
+    FQueueCmd* cmds;
+    unsigned num;
+    unsigned capacity;
+    FQueueCell* cells;
+    FVecInt gridSize;
+    #if F__GEOMETRY
+        SDL_Vertex* vertices;
+        int* indices;
+        unsigned quadsCapacity;
+    #endif
+} g_queue;
+
+void f_platform_sdl_queue__init(void)
+{
+    FVecInt size = f_platform_api__screenSizeGet();
+
+    g_queue.gridSize.x = ((size.x - 1) >> F__CELL_SHIFT) + 1;
+    g_queue.gridSize.y = ((size.y - 1) >> F__CELL_SHIFT) + 1;
+    g_queue.cells = f_mem_mallocz(
+        (size_t)(g_queue.gridSize.x * g_queue.gridSize.y)
+            * sizeof(FQueueCell));
+
+    g_queue.capacity = 256;
+    g_queue.cmds = f_mem_malloc(g_queue.capacity * sizeof(FQueueCmd));
+}
+
+void f_platform_sdl_queue__uninit(void)
+{
+    f_platform_sdl_queue__flush();
+
+    f_mem_free(g_queue.cmds);
+    f_mem_free(g_queue.cells);
+
+    #if F__GEOMETRY
+        f_mem_free(g_queue.vertices);
+        f_mem_free(g_queue.indices);
+    #endif
+}
+
+static inline bool keyEqual(const FQueueKey* A, const FQueueKey* B)
+{
+    return A->texture == B->texture && A->blend == B->blend && A->type == B->type;
+}
+
+static int cmdCompare(const void* A, const void* B)
+{
+    const FQueueCmd* a = A;
+    const FQueueCmd* b = B;
+
+    if(a->level != b->level) {
+        return a->level < b->level ? -1 : 1;
+    }
+
+    if(a->key.texture != b->key.texture) {
+        return (uintptr_t)a->key.texture < (uintptr_t)b->key.texture ? -1 : 1;
+    }
+
+    if(a->key.blend != b->key.blend) {
+        return a->key.blend < b->key.blend ? -1 : 1;
+    }
+
+    if(a->key.type != b->key.type) {
+        return a->key.type < b->key.type ? -1 : 1;
+    }
+
+    return a->seq < b->seq ? -1 : (a->seq > b->seq);
+}
+
+// Commands are drawn sorted by (level, key, order added). A command goes one
+// level above every earlier overlapping command that has a different key, so
+// sorting never swaps two overlapping draws.
+static unsigned levelFind(const FQueueKey* Key, int X1, int Y1, int X2, int Y2)
+{
+    int cx1 = f_math_clamp(X1 >> F__CELL_SHIFT, 0, g_queue.gridSize.x - 1);
+    int cy1 = f_math_clamp(Y1 >> F__CELL_SHIFT, 0, g_queue.gridSize.y - 1);
+    int cx2 = f_math_clamp(X2 >> F__CELL_SHIFT, 0, g_queue.gridSize.x - 1);
+    int cy2 = f_math_clamp(Y2 >> F__CELL_SHIFT, 0, g_queue.gridSize.y - 1);
+
+    unsigned level = 0;
+
+    for(int y = cy1; y <= cy2; y++) {
+        const FQueueCell* cell = &g_queue.cells[y * g_queue.gridSize.x + cx1];
+
+        for(int x = cx1; x <= cx2; x++, cell++) {
+            if(!cell->used) {
+                continue;
+            }
+
+            unsigned l = cell->level;
+
+            if(cell->mixed || !keyEqual(&cell->key, Key)) {
+                l++;
+            }
+
+            level = f_math_maxu(level, l);
+        }
+    }
+
+    for(int y = cy1; y <= cy2; y++) {
+        FQueueCell* cell = &g_queue.cells[y * g_queue.gridSize.x + cx1];
+
+        for(int x = cx1; x <= cx2; x++, cell++) {
+            if(!cell->used || level > cell->level) {
+                cell->key = *Key;
+                cell->level = level;
+                cell->used = true;
+                cell->mixed = false;
+            } else if(!keyEqual(&cell->key, Key)) {
+                cell->mixed = true;
+            }
+        }
+    }
+
+    return level;
+}
+
+static FQueueCmd* cmdAdd(FQueueCmdType Type, SDL_Texture* Texture, int X1, int Y1, int X2, int Y2)
+{
+    if(g_queue.num == g_queue.capacity) {
+        FQueueCmd* cmds = f_mem_malloc(
+                            g_queue.capacity * 2 * sizeof(FQueueCmd));
+
+        memcpy(cmds, g_queue.cmds, g_queue.num * sizeof(FQueueCmd));
+        f_mem_free(g_queue.cmds);
+
+        g_queue.cmds = cmds;
+        g_queue.capacity *= 2;
+    }
+
+    FQueueCmd* cmd = &g_queue.cmds[g_queue.num];
+
+    cmd->key.texture = Texture;
+    cmd->key.blend =
+        (SDL_BlendMode)f_platform_sdl_video__pixelBlendToSdlBlend();
+    cmd->key.type = Type;
+    cmd->level = levelFind(&cmd->key, X1, Y1, X2, Y2);
+    cmd->seq = g_queue.num++;
+    cmd->color = (SDL_Color){(uint8_t)f__color.rgb.r,
+                             (uint8_t)f__color.rgb.g,
+                             (uint8_t)f__color.rgb.b,
+                             f_platform_sdl_video__pixelAlphaToSdlAlpha()};
+
+    return cmd;
+}
+
+void f_platform_sdl_queue__addTexture(FPlatformTextureScreen* Texture, FVecInt TextureSize, FVecInt SrcStart, FVecInt SrcSize, FVecInt DstStart, FVecInt DstSize, FVecInt Center, double Angle, bool ColorMod)
+{
+    int x1 = DstStart.x;
+    int y1 = DstStart.y;
+    int x2 = DstStart.x + DstSize.x - 1;
+    int y2 = DstStart.y + DstSize.y - 1;
+
+    if(Angle != 0 && Angle != 360) {
+        // Box around any rotation, the corner distance is at most dx + dy
+        int r = f_math_max(Center.x, DstSize.x - Center.x)
+              + f_math_max(Center.y, DstSize.y - Center.y);
+
+        x1 = DstStart.x + Center.x - r;
+        y1 = DstStart.y + Center.y - r;
+        x2 = DstStart.x + Center.x + r;
+        y2 = DstStart.y + Center.y + r;
+    }
+
+    FQueueCmd* cmd = cmdAdd(F__CMD_QUAD, Texture, x1, y1, x2, y2);
+
+    if(!ColorMod) {
+        cmd->color.r = 0xff;
+        cmd->color.g = 0xff;
+        cmd->color.b = 0xff;
+    }
+
+    cmd->src = (SDL_Rect){SrcStart.x, SrcStart.y, SrcSize.x, SrcSize.y};
+    cmd->dst = (SDL_Rect){DstStart.x, DstStart.y, DstSize.x, DstSize.y};
+    cmd->center = (SDL_Point){Center.x, Center.y};
+    cmd->angle = Angle;
+    cmd->textureSize = TextureSize;
+}
+
+void f_platform_sdl_queue__addRect(int X, int Y, int Width, int Height)
+{
+    FQueueCmd* cmd = cmdAdd(
+        F__CMD_QUAD, NULL, X, Y, X + Width - 1, Y + Height - 1);
+
+    cmd->dst = (SDL_Rect){X, Y, Width, Height};
+    cmd->angle = 0;
+}
+
+void f_platform_sdl_queue__addLine(int X1, int Y1, int X2, int Y2)
+{
+    FQueueCmd* cmd = cmdAdd(F__CMD_LINE,
+                            NULL,
+                            f_math_min(X1, X2),
+                            f_math_min(Y1, Y2),
+                            f_math_max(X1, X2),
+                            f_math_max(Y1, Y2));
+
+    cmd->dst = (SDL_Rect){X1, Y1, X2, Y2};
+}
+
+static void drawStateSet(const FQueueCmd* Cmd)
+{
+    if(SDL_SetRenderDrawColor(f__sdlRenderer,
+                              Cmd->color.r,
+                              Cmd->color.g,
+                              Cmd->color.b,
+                              Cmd->color.a) < 0) {
+
+        f_out__error("SDL_SetRenderDrawColor: %s", SDL_GetError());
+    }
+}
+
+static void batchLines(const FQueueCmd* Cmds, unsigned Num)
+{
+    if(SDL_SetRenderDrawBlendMode(f__sdlRenderer, Cmds[0].key.blend) < 0) {
+        f_out__error("SDL_SetRenderDrawBlendMode: %s", SDL_GetError());
+    }
+
+    for(unsigned i = 0; i < Num; i++) {
+        const FQueueCmd* cmd = &Cmds[i];
+
+        drawStateSet(cmd);
+
+        if(SDL_RenderDrawLine(f__sdlRenderer,
+                              cmd->dst.x,
+                              cmd->dst.y,
+                              cmd->dst.w,
+                              cmd->dst.h) < 0) {
+
+            f_out__error("SDL_RenderDrawLine: %s", SDL_GetError());
+        }
+    }
+}
+
+#if F__GEOMETRY
+static void batchQuads(const FQueueCmd* Cmds, unsigned Num)
+{
+    if(Num > g_queue.quadsCapacity) {
+        f_mem_free(g_queue.vertices);
+        f_mem_free(g_queue.indices);
+
+        g_queue.quadsCapacity = f_math_maxu(Num, 2 * g_queue.quadsCapacity);
+        g_queue.vertices = f_mem_malloc(
+                            g_queue.quadsCapacity * 4 * sizeof(SDL_Vertex));
+        g_queue.indices = f_mem_malloc(
+                            g_queue.quadsCapacity * 6 * sizeof(int));
+
+        for(unsigned q = 0; q < g_queue.quadsCapacity; q++) {
+            int v = (int)q * 4;
+            int* i = &g_queue.indices[q * 6];
+
+            i[0] = v;
+            i[1] = v + 1;
+            i[2] = v + 2;
+            i[3] = v;
+            i[4] = v + 2;
+            i[5] = v + 3;
+        }
+    }
+
+    SDL_Vertex* v = g_queue.vertices;
+
+    for(unsigned i = 0; i < Num; i++, v += 4) {
+        const FQueueCmd* cmd = &Cmds[i];
+
+        float x1 = (float)cmd->dst.x;
+        float y1 = (float)cmd->dst.y;
+        float x2 = (float)(cmd->dst.x + cmd->dst.w);
+        float y2 = (float)(cmd->dst.y + cmd->dst.h);
+
+        v[0].position = (SDL_FPoint){x1, y1};
+        v[1].position = (SDL_FPoint){x2, y1};
+        v[2].position = (SDL_FPoint){x2, y2};
+        v[3].position = (SDL_FPoint){x1, y2};
+
+        if(cmd->angle != 0 && cmd->angle != 360) {
+            // Clockwise around the center point, same as SDL_RenderCopyEx
+            double rad = cmd->angle * M_PI / 180;
+            float sin = (float)SDL_sin(rad);
+            float cos = (float)SDL_cos(rad);
+            float cx = (float)(cmd->dst.x + cmd->center.x);
+            float cy = (float)(cmd->dst.y + cmd->center.y);
+
+            for(int c = 0; c < 4; c++) {
+                float dx = v[c].position.x - cx;
+                float dy = v[c].position.y - cy;
+
+                v[c].position.x = cx + dx * cos - dy * sin;
+                v[c].position.y = cy + dx * sin + dy * cos;
+            }
+        }
+
+        if(cmd->key.texture) {
+            float w = (float)cmd->textureSize.x;
+            float h = (float)cmd->textureSize.y;
+            float u1 = (float)cmd->src.x / w;
+            float v1 = (float)cmd->src.y / h;
+            float u2 = (float)(cmd->src.x + cmd->src.w) / w;
+            float v2 = (float)(cmd->src.y + cmd->src.h) / h;
+
+            v[0].tex_coord = (SDL_FPoint){u1, v1};
+            v[1].tex_coord = (SDL_FPoint){u2, v1};
+            v[2].tex_coord = (SDL_FPoint){u2, v2};
+            v[3].tex_coord = (SDL_FPoint){u1, v2};
+        } else {
+            v[0].tex_coord = v[1].tex_coord = (SDL_FPoint){0, 0};
+            v[2].tex_coord = v[3].tex_coord = (SDL_FPoint){0, 0};
+        }
+
+        v[0].color = v[1].color = v[2].color = v[3].color = cmd->color;
+    }
+
+    SDL_Texture* tex = Cmds[0].key.texture;
+
+    if(tex) {
+        if(SDL_SetTextureBlendMode(tex, Cmds[0].key.blend) < 0) {
+            f_out__error("SDL_SetTextureBlendMode: %s", SDL_GetError());
+        }
+    } else {
+        if(SDL_SetRenderDrawBlendMode(f__sdlRenderer, Cmds[0].key.blend) < 0) {
+            f_out__error("SDL_SetRenderDrawBlendMode: %s", SDL_GetError());
+        }
+    }
+
+    if(SDL_RenderGeometry(f__sdlRenderer,
+                          tex,
+                          g_queue.vertices,
+                          (int)Num * 4,
+                          g_queue.indices,
+                          (int)Num * 6) < 0) {
+
+        f_out__error("SDL_RenderGeometry: %s", SDL_GetError());
+    }
+}
+#else // !F__GEOMETRY
+static void batchQuads(const FQueueCmd* Cmds, unsigned Num)
+{
+    SDL_Texture* tex = Cmds[0].key.texture;
+
+    if(tex) {
+        if(SDL_SetTextureBlendMode(tex, Cmds[0].key.blend) < 0) {
+            f_out__error("SDL_SetTextureBlendMode: %s", SDL_GetError());
+        }
+    } else {
+        if(SDL_SetRenderDrawBlendMode(f__sdlRenderer, Cmds[0].key.blend) < 0) {
+            f_out__error("SDL_SetRenderDrawBlendMode: %s", SDL_GetError());
+        }
+    }
+
+    SDL_Color color = {0xff, 0xff, 0xff, 0xff};
+
+    for(unsigned i = 0; i < Num; i++) {
+        const FQueueCmd* cmd = &Cmds[i];
+
+        if(tex == NULL) {
+            drawStateSet(cmd);
+
+            if(SDL_RenderFillRect(f__sdlRenderer, &cmd->dst) < 0) {
+                f_out__error("SDL_RenderFillRect: %s", SDL_GetError());
+            }
+
+            continue;
+        }
+
+        if(cmd->color.a != color.a
+            && SDL_SetTextureAlphaMod(tex, cmd->color.a) < 0) {
+
+            f_out__error("SDL_SetTextureAlphaMod: %s", SDL_GetError());
+        }
+
+        if((cmd->color.r != color.r
+                || cmd->color.g != color.g
+                || cmd->color.b != color.b)
+            && SDL_SetTextureColorMod(
+                    tex, cmd->color.r, cmd->color.g, cmd->color.b) < 0) {
+
+            f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
+        }
+
+        color = cmd->color;
+
+        if(SDL_RenderCopyEx(f__sdlRenderer,
+                            tex,
+                            &cmd->src,
+                            &cmd->dst,
+                            cmd->angle,
+                            &cmd->center,
+                            SDL_FLIP_NONE) < 0) {
+
+            f_out__error("SDL_RenderCopyEx: %s", SDL_GetError());
+        }
+    }
+
+    if(tex) {
+        if(SDL_SetTextureAlphaMod(tex, 0xff) < 0) {
+            f_out__error("SDL_SetTextureAlphaMod: %s", SDL_GetError());
+        }
+
+        if(SDL_SetTextureColorMod(tex, 0xff, 0xff, 0xff) < 0) {
+            f_out__error("SDL_SetTextureColorMod: %s", SDL_GetError());
+        }
+    }
+}
+#endif // !F__GEOMETRY
+
+void f_platform_sdl_queue__flush(void)
+{
+    if(g_queue.num == 0) {
+        return;
+    }
+
+    qsort(g_queue.cmds, g_queue.num, sizeof(FQueueCmd), cmdCompare);
+
+    for(unsigned start = 0, end; start < g_queue.num; start = end) {
+        const FQueueCmd* batch = &g_queue.cmds[start];
+
+        for(end = start + 1;
+            end < g_queue.num && keyEqual(&g_queue.cmds[end].key, &batch->key);
+            end++) {
+
+            continue;
+        }
+
+        if(batch->key.type == F__CMD_LINE) {
+            batchLines(batch, end - start);
+        } else {
+            batchQuads(batch, end - start);
+        }
+    }
+
+    g_queue.num = 0;
+
+    memset(g_queue.cells,
+           0,
+           (size_t)(g_queue.gridSize.x * g_queue.gridSize.y)
+            * sizeof(FQueueCell));
+
+    // Restore user settings
+    f_platform_api__drawSetColor();
+    f_platform_api__drawSetBlend();
+}
+#endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2 && F_CONFIG_SCREEN_RENDER_QUEUE
@@ -0,0 +1,35 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_PLATFORM_GRAPHICS_SDL_QUEUE_V_H
+#define F_INC_PLATFORM_GRAPHICS_SDL_QUEUE_V_H
+
+#include "f_sdl_queue.p.h"
+
+#include "../f_platform.v.h"
+#include "../../math/f_vec.v.h"
+
+extern void f_platform_sdl_queue__init(void);
+extern void f_platform_sdl_queue__uninit(void);
+
+extern void f_platform_sdl_queue__flush(void);
+
+extern void f_platform_sdl_queue__addTexture(FPlatformTextureScreen* Texture, FVecInt TextureSize, FVecInt SrcStart, FVecInt SrcSize, FVecInt DstStart, FVecInt DstSize, FVecInt Center, double Angle, bool ColorMod);
+extern void f_platform_sdl_queue__addRect(int X, int Y, int Width, int Height);
+extern void f_platform_sdl_queue__addLine(int X1, int Y1, int X2, int Y2);
+
+#endif // F_INC_PLATFORM_GRAPHICS_SDL_QUEUE_V_H
@@ -0,0 +1,530 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_software_bands.v.h"
+#include <faur.v.h>
+
+#include "f_software_draw.v.h"
+
+#if F__RENDER_BANDS
+// Split the screen into this many bands per thread, so one busy band
+// does not leave the other threads idle
+#define F__BANDS_PER_THREAD 2
+
+typedef enum {
+    F__BAND_PIXEL,
+    F__BAND_LINE,
+    F__BAND_LINE_H,
+    F__BAND_LINE_V,
+    F__BAND_RECTANGLE_OUTLINE,
+    F__BAND_RECTANGLE_FILLED,
+    F__BAND_CIRCLE_OUTLINE,
+    F__BAND_CIRCLE_FILLED,
+    F__BAND_BLIT,
+    F__BAND_BLIT_EX,
+} FBandCmdType;
+
+typedef struct {
+    FBandCmdType type;
+    int yStart, yEnd; // screen rows the draw can touch
+    FVecInt clipStart, clipEnd;
+    FColorState color;
+    union {
+        int coords[4];
+        struct {
+            const FPlatformTexture* texture;
+            const FPixels* pixels;
+            unsigned frame;
+            int x, y;
+            FFix scale;
+            unsigned angle;
+            FFix centerX, centerY;
+        } blit;
+    } u;
+} FBandCmd;
+
+static struct {
+    FBandCmd* cmds;
+    unsigned num;
+    unsigned capacity;
+    unsigned bandsNum; // 0 if there are no worker threads to share with
+    bool replaying; // clipped draws call back into the platform API
+} g_bands;
+
+void f_platform_software_bands__init(void)
+{
+    unsigned threads = f_platform_api__workThreadsGet();
+
+    if(threads > 1) {
+        g_bands.bandsNum = threads * F__BANDS_PER_THREAD;
+
+        f_out__info("Drawing on %u screen bands", g_bands.bandsNum);
+    }
+
+    g_bands.capacity = 256;
+    g_bands.cmds = f_mem_malloc(g_bands.capacity * sizeof(FBandCmd));
+}
+
+void f_platform_software_bands__uninit(void)
+{
+    f_platform_software_bands__flush();
+
+    f_mem_free(g_bands.cmds);
+}
+
+static void bandRun(void* Context, unsigned Index)
+{
+    const FScreen* screen = Context;
+    int height = screen->pixels->size.y;
+    int bandStart = (int)((unsigned)height * Index / g_bands.bandsNum);
+    int bandEnd = (int)((unsigned)height * (Index + 1) / g_bands.bandsNum);
+
+    f__screen = *screen;
+
+    for(unsigned c = 0; c < g_bands.num; c++) {
+        const FBandCmd* cmd = &g_bands.cmds[c];
+
+        if(cmd->yEnd <= bandStart || cmd->yStart >= bandEnd) {
+            continue;
+        }
+
+        f__screen.clipStart.x = cmd->clipStart.x;
+        f__screen.clipStart.y = f_math_max(cmd->clipStart.y, bandStart);
+        f__screen.clipEnd.x = cmd->clipEnd.x;
+        f__screen.clipEnd.y = f_math_min(cmd->clipEnd.y, bandEnd);
+        f__screen.clipSize.x = f__screen.clipEnd.x - f__screen.clipStart.x;
+        f__screen.clipSize.y = f__screen.clipEnd.y - f__screen.clipStart.y;
+
+        f__color = cmd->color;
+
+        const int* c4 = cmd->u.coords;
+
+        switch(cmd->type) {
+            case F__BAND_PIXEL: {
+                f_platform_api_software__drawPixel(c4[0], c4[1]);
+            } break;
+
+            case F__BAND_LINE: {
+                // Clipping a sloped line to the band would move its end
+                // points and shift the pixels in between, so clip it to
+                // its own rows and only plot the ones in this band
+                f__screen.clipStart.y = cmd->clipStart.y;
+                f__screen.clipEnd.y = cmd->clipEnd.y;
+                f__screen.clipSize.y = cmd->clipEnd.y - cmd->clipStart.y;
+
+                f_platform_software_draw__lineRows(
+                    c4[0], c4[1], c4[2], c4[3], bandStart, bandEnd);
+            } break;
+
+            case F__BAND_LINE_H: {
+                f_platform_api_software__drawLineH(c4[0], c4[1], c4[2]);
+            } break;
+
+            case F__BAND_LINE_V: {
+                f_platform_api_software__drawLineV(c4[0], c4[1], c4[2]);
+            } break;
+
+            case F__BAND_RECTANGLE_OUTLINE: {
+                f_platform_api_software__drawRectangleOutline(
+                    c4[0], c4[1], c4[2], c4[3]);
+            } break;
+
+            case F__BAND_RECTANGLE_FILLED: {
+                f_platform_api_software__drawRectangleFilled(
+                    c4[0], c4[1], c4[2], c4[3]);
+            } break;
+
+            case F__BAND_CIRCLE_OUTLINE: {
+                f_platform_api_software__drawCircleOutline(
+                    c4[0], c4[1], c4[2]);
+            } break;
+
+            case F__BAND_CIRCLE_FILLED: {
+                f_platform_api_software__drawCircleFilled(
+                    c4[0], c4[1], c4[2]);
+            } break;
+
+            case F__BAND_BLIT: {
+                f_platform_api_software__textureBlit(cmd->u.blit.texture,
+                                                     cmd->u.blit.pixels,
+                                                     cmd->u.blit.frame,
+                                                     cmd->u.blit.x,
+                                                     cmd->u.blit.y);
+            } break;
+
+            case F__BAND_BLIT_EX: {
+                f_platform_api_software__textureBlitEx(cmd->u.blit.texture,
+                                                       cmd->u.blit.pixels,
+                                                       cmd->u.blit.frame,
+                                                       cmd->u.blit.x,
+                                                       cmd->u.blit.y,
+                                                       cmd->u.blit.scale,
+                                                       cmd->u.blit.angle,
+                                                       cmd->u.blit.centerX,
+                                                       cmd->u.blit.centerY);
+            } break;
+        }
+    }
+}
+
+void f_platform_software_bands__flush(void)
+{
+    if(g_bands.num == 0) {
+        return;
+    }
+
+    // The calling thread replays bands too, so keep its state
+    FScreen screen = f__screen;
+    FColorState color = f__color;
+
+    // Damage was added as the draws were recorded
+    f_screen__damageLock(true);
+    g_bands.replaying = true;
+
+    f_platform_api__workRun(bandRun, &screen, g_bands.bandsNum);
+
+    g_bands.replaying = false;
+    f_screen__damageLock(false);
+
+    f__screen = screen;
+    f__color = color;
+
+    g_bands.num = 0;
+}
+
+void f_platform_software_bands__discard(void)
+{
+    g_bands.num = 0;
+}
+
+// Draws to sprites, or with nobody to share the work with, run right away
+static inline bool recording(void)
+{
+    return g_bands.bandsNum > 0
+        && f__screen.sprite == NULL
+        && !g_bands.replaying;
+}
+
+// Returns NULL if the bounding box is entirely outside the clip area
+static FBandCmd* cmdAdd(FBandCmdType Type, int X, int Y, int Width, int Height)
+{
+    if(!f_screen_boxOnClip(X, Y, Width, Height)) {
+        return NULL;
+    }
+
+    if(g_bands.num == g_bands.capacity) {
+        FBandCmd* cmds = f_mem_malloc(
+                            g_bands.capacity * 2 * sizeof(FBandCmd));
+
+        memcpy(cmds, g_bands.cmds, g_bands.num * sizeof(FBandCmd));
+        f_mem_free(g_bands.cmds);
+
+        g_bands.cmds = cmds;
+        g_bands.capacity *= 2;
+    }
+
+    FBandCmd* cmd = &g_bands.cmds[g_bands.num++];
+
+    cmd->type = Type;
+    cmd->yStart = f_math_max(Y, f__screen.clipStart.y);
+    cmd->yEnd = f_math_min(Y + Height, f__screen.clipEnd.y);
+    cmd->clipStart = f__screen.clipStart;
+    cmd->clipEnd = f__screen.clipEnd;
+    cmd->color = f__color;
+
+    f_screen__damageAdd(X, Y, Width, Height);
+
+    return cmd;
+}
+
+static void cmdAddCoords(FBandCmdType Type, int X, int Y, int Width, int Height, int A, int B, int C, int D)
+{
+    FBandCmd* cmd = cmdAdd(Type, X, Y, Width, Height);
+
+    if(cmd) {
+        cmd->u.coords[0] = A;
+        cmd->u.coords[1] = B;
+        cmd->u.coords[2] = C;
+        cmd->u.coords[3] = D;
+    }
+}
+
+static bool textureQueued(const FPlatformTexture* Texture)
+{
+    for(unsigned c = g_bands.num; c--; ) {
+        const FBandCmd* cmd = &g_bands.cmds[c];
+
+        if((cmd->type == F__BAND_BLIT || cmd->type == F__BAND_BLIT_EX)
+            && cmd->u.blit.texture == Texture) {
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void f_platform_software_bands__pixelsFlush(const FPixels* Pixels)
+{
+    for(unsigned c = g_bands.num; c--; ) {
+        const FBandCmd* cmd = &g_bands.cmds[c];
+
+        if((cmd->type == F__BAND_BLIT || cmd->type == F__BAND_BLIT_EX)
+            && cmd->u.blit.pixels == Pixels) {
+
+            f_platform_software_bands__flush();
+
+            return;
+        }
+    }
+}
+
+void f_platform_api_bands__drawPixel(int X, int Y)
+{
+    if(!recording()) {
+        f_platform_api_software__drawPixel(X, Y);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_PIXEL, X, Y, 1, 1, X, Y, 0, 0);
+}
+
+void f_platform_api_bands__drawPixels(const FVecInt* Points, unsigned Num)
+{
+    if(!recording()) {
+        f_platform_api_software__drawPixels(Points, Num);
+
+        return;
+    }
+
+    for(unsigned i = 0; i < Num; i++) {
+        f_platform_api_bands__drawPixel(Points[i].x, Points[i].y);
+    }
+}
+
+void f_platform_api_bands__drawLine(int X1, int Y1, int X2, int Y2)
+{
+    if(!recording()) {
+        f_platform_api_software__drawLine(X1, Y1, X2, Y2);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_LINE,
+                 f_math_min(X1, X2),
+                 f_math_min(Y1, Y2),
+                 f_math_abs(X2 - X1) + 1,
+                 f_math_abs(Y2 - Y1) + 1,
+                 X1,
+                 Y1,
+                 X2,
+                 Y2);
+}
+
+void f_platform_api_bands__drawLines(const FVecInt* Points, unsigned Num)
+{
+    if(!recording()) {
+        f_platform_api_software__drawLines(Points, Num);
+
+        return;
+    }
+
+    for(unsigned i = 0; i < Num; i++, Points += 2) {
+        f_platform_api_bands__drawLine(
+            Points[0].x, Points[0].y, Points[1].x, Points[1].y);
+    }
+}
+
+void f_platform_api_bands__drawLineH(int X1, int X2, int Y)
+{
+    if(!recording()) {
+        f_platform_api_software__drawLineH(X1, X2, Y);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_LINE_H, X1, Y, X2 - X1 + 1, 1, X1, X2, Y, 0);
+}
+
+void f_platform_api_bands__drawLineV(int X, int Y1, int Y2)
+{
+    if(!recording()) {
+        f_platform_api_software__drawLineV(X, Y1, Y2);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_LINE_V, X, Y1, 1, Y2 - Y1 + 1, X, Y1, Y2, 0);
+}
+
+void f_platform_api_bands__drawRectangleOutline(int X, int Y, int Width, int Height)
+{
+    if(!recording()) {
+        f_platform_api_software__drawRectangleOutline(X, Y, Width, Height);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_RECTANGLE_OUTLINE,
+                 X, Y, Width, Height,
+                 X, Y, Width, Height);
+}
+
+void f_platform_api_bands__drawRectangleFilled(int X, int Y, int Width, int Height)
+{
+    if(!recording()) {
+        f_platform_api_software__drawRectangleFilled(X, Y, Width, Height);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_RECTANGLE_FILLED,
+                 X, Y, Width, Height,
+                 X, Y, Width, Height);
+}
+
+void f_platform_api_bands__drawRectanglesOutline(const FVecInt* Rects, unsigned Num)
+{
+    if(!recording()) {
+        f_platform_api_software__drawRectanglesOutline(Rects, Num);
+
+        return;
+    }
+
+    for(unsigned i = 0; i < Num; i++, Rects += 2) {
+        f_platform_api_bands__drawRectangleOutline(
+            Rects[0].x, Rects[0].y, Rects[1].x, Rects[1].y);
+    }
+}
+
+void f_platform_api_bands__drawRectanglesFilled(const FVecInt* Rects, unsigned Num)
+{
+    if(!recording()) {
+        f_platform_api_software__drawRectanglesFilled(Rects, Num);
+
+        return;
+    }
+
+    for(unsigned i = 0; i < Num; i++, Rects += 2) {
+        f_platform_api_bands__drawRectangleFilled(
+            Rects[0].x, Rects[0].y, Rects[1].x, Rects[1].y);
+    }
+}
+
+void f_platform_api_bands__drawCircleOutline(int X, int Y, int Radius)
+{
+    if(!recording()) {
+        f_platform_api_software__drawCircleOutline(X, Y, Radius);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_CIRCLE_OUTLINE,
+                 X - Radius, Y - Radius, 2 * Radius + 1, 2 * Radius + 1,
+                 X, Y, Radius, 0);
+}
+
+void f_platform_api_bands__drawCircleFilled(int X, int Y, int Radius)
+{
+    if(!recording()) {
+        f_platform_api_software__drawCircleFilled(X, Y, Radius);
+
+        return;
+    }
+
+    cmdAddCoords(F__BAND_CIRCLE_FILLED,
+                 X - Radius, Y - Radius, 2 * Radius + 1, 2 * Radius + 1,
+                 X, Y, Radius, 0);
+}
+
+void f_platform_api_bands__textureFree(FPlatformTexture* Texture)
+{
+    if(textureQueued(Texture)) {
+        f_platform_software_bands__flush();
+    }
+
+    f_platform_api_software__textureFree(Texture);
+}
+
+void f_platform_api_bands__textureUpdate(FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame)
+{
+    if(textureQueued(Texture)) {
+        f_platform_software_bands__flush();
+    }
+
+    f_platform_api_software__textureUpdate(Texture, Pixels, Frame);
+}
+
+void f_platform_api_bands__textureBlit(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y)
+{
+    if(!recording()) {
+        f_platform_api_software__textureBlit(Texture, Pixels, Frame, X, Y);
+
+        return;
+    }
+
+    FBandCmd* cmd = cmdAdd(
+                        F__BAND_BLIT, X, Y, Pixels->size.x, Pixels->size.y);
+
+    if(cmd) {
+        cmd->u.blit.texture = Texture;
+        cmd->u.blit.pixels = Pixels;
+        cmd->u.blit.frame = Frame;
+        cmd->u.blit.x = X;
+        cmd->u.blit.y = Y;
+    }
+}
+
+void f_platform_api_bands__textureBlitEx(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y, FFix Scale, unsigned Angle, FFix CenterX, FFix CenterY)
+{
+    if(!recording()) {
+        f_platform_api_software__textureBlitEx(
+            Texture, Pixels, Frame, X, Y, Scale, Angle, CenterX, CenterY);
+
+        return;
+    }
+
+    // The rotated sprite fits in a square around (X, Y) whose half-side is
+    // the sum of the longest horizontal and vertical extents from the center
+    const FVecFix sizeScaled = {Pixels->size.x * Scale,
+                                Pixels->size.y * Scale};
+    const FFix wLeft =
+        sizeScaled.x / 2 + f_fix_mul(CenterX, sizeScaled.x / 2);
+    const FFix hTop =
+        sizeScaled.y / 2 + f_fix_mul(CenterY, sizeScaled.y / 2);
+    const int r = f_fix_toInt(
+                    f_math_max(f_math_abs(wLeft),
+                               f_math_abs(sizeScaled.x - wLeft))
+                        + f_math_max(f_math_abs(hTop),
+                                     f_math_abs(sizeScaled.y - hTop))) + 1;
+
+    FBandCmd* cmd = cmdAdd(F__BAND_BLIT_EX, X - r, Y - r, 2 * r + 1, 2 * r + 1);
+
+    if(cmd) {
+        cmd->u.blit.texture = Texture;
+        cmd->u.blit.pixels = Pixels;
+        cmd->u.blit.frame = Frame;
+        cmd->u.blit.x = X;
+        cmd->u.blit.y = Y;
+        cmd->u.blit.scale = Scale;
+        cmd->u.blit.angle = Angle;
+        cmd->u.blit.centerX = CenterX;
+        cmd->u.blit.centerY = CenterY;
+    }
+}
+#endif // F__RENDER_BANDS
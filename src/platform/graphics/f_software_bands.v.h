@@ -0,0 +1,50 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_PLATFORM_GRAPHICS_SOFTWARE_BANDS_V_H
+#define F_INC_PLATFORM_GRAPHICS_SOFTWARE_BANDS_V_H
+
+#include "f_software_bands.p.h"
+
+#include "../f_platform.v.h"
+
+extern void f_platform_software_bands__init(void);
+extern void f_platform_software_bands__uninit(void);
+
+extern void f_platform_software_bands__flush(void);
+extern void f_platform_software_bands__discard(void);
+extern void f_platform_software_bands__pixelsFlush(const FPixels* Pixels);
+
+extern FCallApi_DrawPixel f_platform_api_bands__drawPixel;
+extern FCallApi_DrawPixels f_platform_api_bands__drawPixels;
+extern FCallApi_DrawLine f_platform_api_bands__drawLine;
+extern FCallApi_DrawLines f_platform_api_bands__drawLines;
+extern FCallApi_DrawLineH f_platform_api_bands__drawLineH;
+extern FCallApi_DrawLineV f_platform_api_bands__drawLineV;
+extern FCallApi_DrawRectangleOutline f_platform_api_bands__drawRectangleOutline;
+extern FCallApi_DrawRectangleFilled f_platform_api_bands__drawRectangleFilled;
+extern FCallApi_DrawRectanglesOutline f_platform_api_bands__drawRectanglesOutline;
+extern FCallApi_DrawRectanglesFilled f_platform_api_bands__drawRectanglesFilled;
+extern FCallApi_DrawCircleOutline f_platform_api_bands__drawCircleOutline;
+extern FCallApi_DrawCircleFilled f_platform_api_bands__drawCircleFilled;
+
+extern FCallApi_TextureFree f_platform_api_bands__textureFree;
+extern FCallApi_TextureUpdate f_platform_api_bands__textureUpdate;
+extern FCallApi_TextureBlit f_platform_api_bands__textureBlit;
+extern FCallApi_TextureBlitEx f_platform_api_bands__textureBlitEx;
+
+#endif // F_INC_PLATFORM_GRAPHICS_SOFTWARE_BANDS_V_H
@@ -16,6 +16,7 @@
 */
 
 #include "f_software_blit.v.h"
+#include "f_software_span.v.h"
 #include <faur.v.h>
 
 #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
@@ -33,16 +34,30 @@ typedef struct {
 
 typedef struct {
     FSpriteWord framesNum;
-    FSpriteWord* spans[1]; // [framesNum]
+    FTextureSoftFrame frames[1]; // [framesNum]
 } FTextureSoft;
 
 typedef void (*FCallBlitter)(const FTextureSoft* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y);
 typedef void (*FCallBlitterEx)(const FPixels* Pixels, unsigned Frame, int TopY, int BottomY);
 
+// Axis-aligned blitEx, every screen row and column maps to a sprite line
+typedef struct {
+    const void* origin; // sprite pixel at the unclipped top-left
+    const FColorPixel* lut; // if the sprite is indexed
+    int strideU, strideV; // buffer step for one sprite line right and down
+    FFix incU, incV; // sprite lines per screen pixel right and down
+    FFix startU, startV; // sprite position at the clipped top-left
+    FVecInt start, end; // clipped screen area, [start, end)
+} FBlitAxis;
+
+typedef void (*FCallBlitterAxis)(const FBlitAxis* Axis);
+
 static FScanlineEdge g_edges[2];
 
 // Interpolate sprite side (SprP1, SprP2) along screen line (ScrP1, ScrP2).
-// ScrP1.y <= ScrP2.y and at least part of this range is on screen.
+// ScrP1.y <= ScrP2.y and at least part of this range is on the clip area.
+// Only rows inside the clip area are written, so draws that are clipped to
+// different screen bands never touch the same entries.
 static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix SprP1, FVecFix SprP2)
 {
     // Happens when sprite angle is a multiple of 90deg,
@@ -64,17 +79,19 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
     int sprIncX = sprDX / scrDY;
     int sprIncY = sprDY / scrDY;
 
-    if(ScrP1.y < 0) {
-        scrX += scrIncX * -ScrP1.y;
+    if(ScrP1.y < f__screen.clipStart.y) {
+        int skip = f__screen.clipStart.y - ScrP1.y;
 
-        sprX += sprIncX * -ScrP1.y;
-        sprY += sprIncY * -ScrP1.y;
+        scrX += scrIncX * skip;
 
-        ScrP1.y = 0;
+        sprX += sprIncX * skip;
+        sprY += sprIncY * skip;
+
+        ScrP1.y = f__screen.clipStart.y;
     }
 
-    if(ScrP2.y >= f__screen.pixels->size.y) {
-        ScrP2.y = f__screen.pixels->size.y - 1;
+    if(ScrP2.y >= f__screen.clipEnd.y) {
+        ScrP2.y = f__screen.clipEnd.y - 1;
     }
 
     int* sideScreen = Edge->screen;
@@ -91,8 +108,9 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
     }
 }
 
-#define F__FUNC_NAME(ColorKey, Clip) F_GLUE5(f_blit__, F__BLEND, F__FILL, ColorKey, Clip)
-#define F__FUNC_NAME_EX F_GLUE4(f_blitEx__, F__BLEND, F__FILL, F__COLORKEY)
+#define F__FUNC_NAME(ColorKey, Clip) F_GLUE5(F__SRC_NAME(f_blit), F__BLEND, F__FILL, ColorKey, Clip)
+#define F__FUNC_NAME_EX F_GLUE4(F__SRC_NAME(f_blitEx), F__BLEND, F__FILL, F__COLORKEY)
+#define F__FUNC_NAME_AXIS F_GLUE4(F__SRC_NAME(f_blitAxis), F__BLEND, F__FILL, F__COLORKEY)
 #define F__PIXEL_DRAW(Dst) F_GLUE2(f_color__draw_, F__BLEND)(Dst F__PIXEL_PARAMS)
 
 #define F__BLEND solid
@@ -100,15 +118,17 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
 #define F__BLEND_SETUP
 #define F__PIXEL_USE_SRC
 #define F__PIXEL_SETUP
-#define F__PIXEL_PARAMS , *src
-#include "f_software_blit.inc.c"
+#define F__PIXEL_PARAMS , F__SRC_PIXEL
+#define F__SPAN_DRAW(Len) f_platform_software_span__solidData(dst, src, Len)
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND solid
 #define F__FILL Flat
 #define F__BLEND_SETUP const FColorPixel color = f__color.pixel;
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS , color
-#include "f_software_blit.inc.c"
+#define F__SPAN_DRAW(Len) f_platform_software_span__solidFlat(dst, color, Len)
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND alpha
 #define F__FILL Data
@@ -118,9 +138,10 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
         return; \
     }
 #define F__PIXEL_USE_SRC
-#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
 #define F__PIXEL_PARAMS , &rgb, alpha
-#include "f_software_blit.inc.c"
+#define F__SPAN_DRAW(Len) f_platform_software_span__alphaData(dst, src, Len, alpha)
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND alpha
 #define F__FILL Flat
@@ -132,53 +153,60 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
     }
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS , &rgb, alpha
-#include "f_software_blit.inc.c"
+#define F__SPAN_DRAW(Len) f_platform_software_span__alphaFlat(dst, &rgb, Len, alpha)
+#include "f_software_blit_formats.inc.c"
 
 #if F__OPTIMIZE_ALPHA
     #define F__BLEND alpha25
     #define F__FILL Data
     #define F__BLEND_SETUP
     #define F__PIXEL_USE_SRC
-    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha25Data(dst, src, Len)
+    #include "f_software_blit_formats.inc.c"
 
     #define F__BLEND alpha25
     #define F__FILL Flat
     #define F__BLEND_SETUP const FColorRgb rgb = f__color.rgb;
     #define F__PIXEL_SETUP
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha25Flat(dst, &rgb, Len)
+    #include "f_software_blit_formats.inc.c"
 
     #define F__BLEND alpha50
     #define F__FILL Data
     #define F__BLEND_SETUP
     #define F__PIXEL_USE_SRC
-    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha50Data(dst, src, Len)
+    #include "f_software_blit_formats.inc.c"
 
     #define F__BLEND alpha50
     #define F__FILL Flat
     #define F__BLEND_SETUP const FColorRgb rgb = f__color.rgb;
     #define F__PIXEL_SETUP
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha50Flat(dst, &rgb, Len)
+    #include "f_software_blit_formats.inc.c"
 
     #define F__BLEND alpha75
     #define F__FILL Data
     #define F__BLEND_SETUP
     #define F__PIXEL_USE_SRC
-    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+    #define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha75Data(dst, src, Len)
+    #include "f_software_blit_formats.inc.c"
 
     #define F__BLEND alpha75
     #define F__FILL Flat
     #define F__BLEND_SETUP const FColorRgb rgb = f__color.rgb;
     #define F__PIXEL_SETUP
     #define F__PIXEL_PARAMS , &rgb
-    #include "f_software_blit.inc.c"
+    #define F__SPAN_DRAW(Len) f_platform_software_span__alpha75Flat(dst, &rgb, Len)
+    #include "f_software_blit_formats.inc.c"
 #endif // F__OPTIMIZE_ALPHA
 
 #define F__BLEND alphaMask
@@ -188,8 +216,8 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
     const int alpha = f__color.alpha;
 #define F__PIXEL_USE_SRC
 #define F__PIXEL_SETUP
-#define F__PIXEL_PARAMS , &rgb, alpha, f_color_pixelToRgbAny(*src)
-#include "f_software_blit.inc.c"
+#define F__PIXEL_PARAMS , &rgb, alpha, f_color_pixelToRgbAny(F__SRC_PIXEL)
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND alphaMask
 #define F__FILL Flat
@@ -198,65 +226,69 @@ static void scan_line(FScanlineEdge* Edge, FVecInt ScrP1, FVecInt ScrP2, FVecFix
     const int alpha = f__color.alpha;
 #define F__PIXEL_USE_SRC
 #define F__PIXEL_SETUP
-#define F__PIXEL_PARAMS , &rgb, alpha, f_color_pixelToRgbAny(*src)
-#include "f_software_blit.inc.c"
+#define F__PIXEL_PARAMS , &rgb, alpha, f_color_pixelToRgbAny(F__SRC_PIXEL)
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND inverse
 #define F__FILL Data
 #define F__BLEND_SETUP
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS
-#include "f_software_blit.inc.c"
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND inverse
 #define F__FILL Flat
 #define F__BLEND_SETUP
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS
-#include "f_software_blit.inc.c"
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND mod
 #define F__FILL Data
 #define F__BLEND_SETUP
 #define F__PIXEL_USE_SRC
-#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
 #define F__PIXEL_PARAMS , &rgb
-#include "f_software_blit.inc.c"
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND mod
 #define F__FILL Flat
 #define F__BLEND_SETUP const FColorRgb rgb = f__color.rgb;
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS , &rgb
-#include "f_software_blit.inc.c"
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND add
 #define F__FILL Data
 #define F__BLEND_SETUP
 #define F__PIXEL_USE_SRC
-#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(*src);
+#define F__PIXEL_SETUP const FColorRgb rgb = f_color_pixelToRgb(F__SRC_PIXEL);
 #define F__PIXEL_PARAMS , &rgb
-#include "f_software_blit.inc.c"
+#include "f_software_blit_formats.inc.c"
 
 #define F__BLEND add
 #define F__FILL Flat
 #define F__BLEND_SETUP const FColorRgb rgb = f__color.rgb;
 #define F__PIXEL_SETUP
 #define F__PIXEL_PARAMS , &rgb
-#include "f_software_blit.inc.c"
-
-#define F__INIT_BLEND(Index, Name)                      \
-    [Index][0][0][0] = f_blit__##Name##DataBlockNoClip, \
-    [Index][0][0][1] = f_blit__##Name##DataBlockDoClip, \
-    [Index][0][1][0] = f_blit__##Name##DataKeyedNoClip, \
-    [Index][0][1][1] = f_blit__##Name##DataKeyedDoClip, \
-    [Index][1][0][0] = f_blit__##Name##FlatBlockNoClip, \
-    [Index][1][0][1] = f_blit__##Name##FlatBlockDoClip, \
-    [Index][1][1][0] = f_blit__##Name##FlatKeyedNoClip, \
-    [Index][1][1][1] = f_blit__##Name##FlatKeyedDoClip, \
-
-// [Blend][Fill][ColorKey][Clip]
-static const FCallBlitter g_blitters[F_COLOR_BLEND_NUM][2][2][2] = {
+#include "f_software_blit_formats.inc.c"
+
+#define F__INIT_BLEND_SRC(Src, Prefix, Index, Name)            \
+    [Src][Index][0][0][0] = Prefix##__##Name##DataBlockNoClip, \
+    [Src][Index][0][0][1] = Prefix##__##Name##DataBlockDoClip, \
+    [Src][Index][0][1][0] = Prefix##__##Name##DataKeyedNoClip, \
+    [Src][Index][0][1][1] = Prefix##__##Name##DataKeyedDoClip, \
+    [Src][Index][1][0][0] = Prefix##__##Name##FlatBlockNoClip, \
+    [Src][Index][1][0][1] = Prefix##__##Name##FlatBlockDoClip, \
+    [Src][Index][1][1][0] = Prefix##__##Name##FlatKeyedNoClip, \
+    [Src][Index][1][1][1] = Prefix##__##Name##FlatKeyedDoClip, \
+
+#define F__INIT_BLEND(Index, Name)                   \
+    F__INIT_BLEND_SRC(0, f_blit, Index, Name)        \
+    F__INIT_BLEND_SRC(1, f_blitIndexed, Index, Name) \
+
+// [Indexed][Blend][Fill][ColorKey][Clip]
+static const FCallBlitter g_blitters[2][F_COLOR_BLEND_NUM][2][2][2] = {
     F__INIT_BLEND(F_COLOR_BLEND_SOLID, solid)
     F__INIT_BLEND(F_COLOR_BLEND_ALPHA, alpha)
     #if F__OPTIMIZE_ALPHA
@@ -274,14 +306,18 @@ static const FCallBlitter g_blitters[F_COLOR_BLEND_NUM][2][2][2] = {
     F__INIT_BLEND(F_COLOR_BLEND_ADD, add)
 };
 
-#define F__INIT_BLEND_EX(Index, Name)            \
-    [Index][0][0] = f_blitEx__##Name##DataBlock, \
-    [Index][0][1] = f_blitEx__##Name##DataKeyed, \
-    [Index][1][0] = f_blitEx__##Name##FlatBlock, \
-    [Index][1][1] = f_blitEx__##Name##FlatKeyed, \
+#define F__INIT_BLEND_EX_SRC(Src, Prefix, Index, Name) \
+    [Src][Index][0][0] = Prefix##__##Name##DataBlock,  \
+    [Src][Index][0][1] = Prefix##__##Name##DataKeyed,  \
+    [Src][Index][1][0] = Prefix##__##Name##FlatBlock,  \
+    [Src][Index][1][1] = Prefix##__##Name##FlatKeyed,  \
+
+#define F__INIT_BLEND_EX(Index, Name)                     \
+    F__INIT_BLEND_EX_SRC(0, f_blitEx, Index, Name)        \
+    F__INIT_BLEND_EX_SRC(1, f_blitExIndexed, Index, Name) \
 
-// [Blend][Fill][ColorKey]
-static const FCallBlitterEx g_blittersEx[F_COLOR_BLEND_NUM][2][2] = {
+// [Indexed][Blend][Fill][ColorKey]
+static const FCallBlitterEx g_blittersEx[2][F_COLOR_BLEND_NUM][2][2] = {
     F__INIT_BLEND_EX(F_COLOR_BLEND_SOLID, solid)
     F__INIT_BLEND_EX(F_COLOR_BLEND_ALPHA, alpha)
     #if F__OPTIMIZE_ALPHA
@@ -299,6 +335,35 @@ static const FCallBlitterEx g_blittersEx[F_COLOR_BLEND_NUM][2][2] = {
     F__INIT_BLEND_EX(F_COLOR_BLEND_ADD, add)
 };
 
+#define F__INIT_BLEND_AXIS_SRC(Src, Prefix, Index, Name) \
+    [Src][Index][0][0] = Prefix##__##Name##DataBlock,    \
+    [Src][Index][0][1] = Prefix##__##Name##DataKeyed,    \
+    [Src][Index][1][0] = Prefix##__##Name##FlatBlock,    \
+    [Src][Index][1][1] = Prefix##__##Name##FlatKeyed,    \
+
+#define F__INIT_BLEND_AXIS(Index, Name)                       \
+    F__INIT_BLEND_AXIS_SRC(0, f_blitAxis, Index, Name)        \
+    F__INIT_BLEND_AXIS_SRC(1, f_blitAxisIndexed, Index, Name) \
+
+// [Indexed][Blend][Fill][ColorKey]
+static const FCallBlitterAxis g_blittersAxis[2][F_COLOR_BLEND_NUM][2][2] = {
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_SOLID, solid)
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA, alpha)
+    #if F__OPTIMIZE_ALPHA
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_25, alpha25)
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_50, alpha50)
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_75, alpha75)
+    #else
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_25, alpha)
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_50, alpha)
+        F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_75, alpha)
+    #endif
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_ALPHA_MASK, alphaMask)
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_INVERSE, inverse)
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_MOD, mod)
+    F__INIT_BLEND_AXIS(F_COLOR_BLEND_ADD, add)
+};
+
 void f_platform_software_blit__init(void)
 {
     #if F__SCANLINES_MALLOC
@@ -324,29 +389,38 @@ void f_platform_software_blit__uninit(void)
     #endif
 }
 
-static FSpriteWord* spansNew(const FPixels* Pixels, unsigned Frame)
+static FTextureSoftFrame spansNew(const FPixels* Pixels, unsigned Frame)
 {
-    const FColorPixel* bufferStart =
-        f_pixels__bufferGetStartConst(Pixels, Frame);
-    const FColorPixel* buffer = bufferStart;
-    bool transparent = false;
+    FTextureSoftFrame frame = {NULL, NULL};
 
-    for(unsigned i = Pixels->bufferLen; i--; ) {
-        if(*buffer++ == f_color__key) {
-            transparent = true;
-            break;
-        }
+    if(!f_pixels__keyFind(Pixels, Frame)) {
+        return frame;
     }
 
-    if(!transparent) {
-        return NULL;
+    FColorPixel* expanded = NULL;
+    const FColorPixel* bufferStart;
+
+    if(f_pixels__isIndexed(Pixels)) {
+        // Spans only track transparency, which is index 0
+        const uint8_t* indices = f_pixels__indicesGetStartConst(Pixels, Frame);
+
+        expanded = f_mem_malloc(Pixels->bufferLen * sizeof(FColorPixel));
+
+        for(unsigned i = Pixels->bufferLen; i--; ) {
+            expanded[i] =
+                indices[i] ? (FColorPixel)~f_color__key : f_color__key;
+        }
+
+        bufferStart = expanded;
+    } else {
+        bufferStart = f_pixels__bufferGetStartConst(Pixels, Frame);
     }
 
     // Spans format for each scanline:
     // (NumSpans << 1 | start draw/transparent), len0, len1, ...
 
     size_t bytesNeeded = 0;
-    buffer = bufferStart;
+    const FColorPixel* buffer = bufferStart;
 
     for(int y = Pixels->size.y; y--; ) {
         bytesNeeded += sizeof(FSpriteWord); // NumSpans, initial state
@@ -366,6 +440,13 @@ static FSpriteWord* spansNew(const FPixels* Pixels, unsigned Frame)
     FSpriteWord* spans = spansStart;
     buffer = bufferStart;
 
+    #if F_SOFTWARE_BLIT__SPANS_INDEX
+        FSpansRow* row = f_mem_malloc(
+                            (unsigned)Pixels->size.y * sizeof(FSpansRow));
+
+        frame.rows = row;
+    #endif
+
     for(int y = Pixels->size.y; y--; ) {
         FSpriteWord* lineStart = spans;
         FSpriteWord spanLength = 0;
@@ -373,6 +454,25 @@ static FSpriteWord* spansNew(const FPixels* Pixels, unsigned Frame)
         bool doDraw = *buffer != f_color__key; // initial state
         *spans++ = doDraw;
 
+        #if F_SOFTWARE_BLIT__SPANS_INDEX
+            int opaqueStart = -1, opaqueEnd = 0;
+
+            for(int x = 0; x < Pixels->size.x; x++) {
+                if(buffer[x] != f_color__key) {
+                    if(opaqueStart < 0) {
+                        opaqueStart = x;
+                    }
+
+                    opaqueEnd = x + 1;
+                }
+            }
+
+            row->offset = (unsigned)(lineStart - spansStart);
+            row->opaqueStart = (FSpriteWord)f_math_max(opaqueStart, 0);
+            row->opaqueEnd = (FSpriteWord)opaqueEnd;
+            row++;
+        #endif
+
         for(int x = Pixels->size.x; x--; ) {
             if((*buffer++ != f_color__key) == doDraw) {
                 spanLength++; // keep growing current span
@@ -387,19 +487,41 @@ static FSpriteWord* spansNew(const FPixels* Pixels, unsigned Frame)
         *spans++ = spanLength; // record the last span's length
     }
 
-    return spansStart;
+    frame.spans = spansStart;
+
+    f_mem_free(expanded);
+
+    return frame;
+}
+
+static size_t spansSize(const FSpriteWord* Spans, int Height)
+{
+    const FSpriteWord* spans = Spans;
+
+    for(int y = Height; y--; ) {
+        spans += 1 + (*spans >> 1);
+    }
+
+    return (size_t)(spans - Spans) * sizeof(FSpriteWord);
+}
+
+static void spansFree(FTextureSoftFrame* Frame)
+{
+    f_mem_free(Frame->spans);
+    f_mem_free(Frame->rows);
 }
 
 FPlatformTexture* f_platform_api_software__textureNew(const FPixels* Pixels)
 {
     FTextureSoft* t = f_mem_malloc(
                         sizeof(FTextureSoft)
-                            + (Pixels->framesNum - 1) * sizeof(FSpriteWord*));
+                            + (Pixels->framesNum - 1)
+                                * sizeof(FTextureSoftFrame));
 
     t->framesNum = (FSpriteWord)Pixels->framesNum;
 
     for(unsigned f = Pixels->framesNum; f--; ) {
-        t->spans[f] = spansNew(Pixels, f);
+        t->frames[f] = spansNew(Pixels, f);
     }
 
     return t;
@@ -410,16 +532,25 @@ FPlatformTexture* f_platform_api_software__textureDup(const FPlatformTexture* Te
     const FTextureSoft* texSrc = Texture;
     FTextureSoft* texDst =
         f_mem_mallocz(sizeof(FTextureSoft)
-                        + (Pixels->framesNum - 1) * sizeof(FSpriteWord*));
+                        + (Pixels->framesNum - 1)
+                            * sizeof(FTextureSoftFrame));
 
     texDst->framesNum = texSrc->framesNum;
 
     for(unsigned f = texSrc->framesNum; f--; ) {
-        if(texSrc->spans[f]) {
-            FSpriteWord num = texSrc->spans[f][0] >> 1;
+        const FTextureSoftFrame* frameSrc = &texSrc->frames[f];
+        FTextureSoftFrame* frameDst = &texDst->frames[f];
+
+        if(frameSrc->spans) {
+            frameDst->spans = f_mem_dup(
+                                frameSrc->spans,
+                                spansSize(frameSrc->spans, Pixels->size.y));
+        }
 
-            texDst->spans[f] = f_mem_dup(texSrc->spans[f],
-                                         (num + 1u) * sizeof(FSpriteWord));
+        if(frameSrc->rows) {
+            frameDst->rows = f_mem_dup(
+                                frameSrc->rows,
+                                (unsigned)Pixels->size.y * sizeof(FSpansRow));
         }
     }
 
@@ -435,7 +566,7 @@ void f_platform_api_software__textureFree(FPlatformTexture* Texture)
     FTextureSoft* texture = Texture;
 
     for(unsigned f = texture->framesNum; f--; ) {
-        f_mem_free(texture->spans[f]);
+        spansFree(&texture->frames[f]);
     }
 
     f_mem_free(texture);
@@ -445,9 +576,9 @@ void f_platform_api_software__textureUpdate(FPlatformTexture* Texture, const FPi
 {
     FTextureSoft* texture = Texture;
 
-    f_mem_free(texture->spans[Frame]);
+    spansFree(&texture->frames[Frame]);
 
-    texture->spans[Frame] = spansNew(Pixels, Frame);
+    texture->frames[Frame] = spansNew(Pixels, Frame);
 }
 
 void f_platform_api_software__textureBlit(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y)
@@ -456,14 +587,100 @@ void f_platform_api_software__textureBlit(const FPlatformTexture* Texture, const
         return;
     }
 
+    f_screen__damageAdd(X, Y, Pixels->size.x, Pixels->size.y);
+
     g_blitters
+        [f_pixels__isIndexed(Pixels)]
         [f__color.blend]
         [f__color.fillBlit]
-        [((FTextureSoft*)Texture)->spans[Frame] != NULL]
+        [((FTextureSoft*)Texture)->frames[Frame].spans != NULL]
         [!f_screen_boxInsideClip(X, Y, Pixels->size.x, Pixels->size.y)]
             (Texture, Pixels, Frame, X, Y);
 }
 
+// Sprite rotated by a multiple of 90deg onto screen area [Start, End), this
+// samples the same pixels as the general scanline path without its edges
+static void blitAxis(const FTextureSoft* Texture, const FPixels* Pixels, unsigned Frame, unsigned Angle, FVecInt Start, FVecInt End)
+{
+    const FVecInt size = Pixels->size;
+    const FVecInt screenSize = {End.x - Start.x, End.y - Start.y};
+    const bool keyed = Texture->frames[Frame].spans != NULL;
+
+    if(Angle == 0 && screenSize.x == size.x && screenSize.y == size.y) {
+        // Same as a plain blit, use the sprite's spans
+        g_blitters
+            [f_pixels__isIndexed(Pixels)]
+            [f__color.blend]
+            [f__color.fillBlit]
+            [keyed]
+            [!f_screen_boxInsideClip(Start.x, Start.y, size.x, size.y)]
+                (Texture, Pixels, Frame, Start.x, Start.y);
+
+        return;
+    }
+
+    FBlitAxis axis;
+    int offset;
+
+    // Screen rows go along sprite columns when rotated by 90 or 270deg
+    if(Angle == 0 || Angle == F_DEG_180_INT) {
+        axis.incU = f_fix_fromInt(size.x) / screenSize.x;
+        axis.incV = f_fix_fromInt(size.y) / screenSize.y;
+    } else {
+        axis.incU = f_fix_fromInt(size.y) / screenSize.x;
+        axis.incV = f_fix_fromInt(size.x) / screenSize.y;
+    }
+
+    switch(Angle) {
+        case 0: {
+            offset = 0;
+            axis.strideU = 1;
+            axis.strideV = size.x;
+        } break;
+
+        case F_DEG_090_INT: {
+            offset = size.x - 1;
+            axis.strideU = size.x;
+            axis.strideV = -1;
+        } break;
+
+        case F_DEG_180_INT: {
+            offset = size.x * size.y - 1;
+            axis.strideU = -1;
+            axis.strideV = -size.x;
+        } break;
+
+        default: {
+            offset = size.x * (size.y - 1);
+            axis.strideU = -size.x;
+            axis.strideV = 1;
+        } break;
+    }
+
+    if(f_pixels__isIndexed(Pixels)) {
+        axis.origin = f_pixels__indicesGetStartConst(Pixels, Frame) + offset;
+    } else {
+        axis.origin = f_pixels__bufferGetStartConst(Pixels, Frame) + offset;
+    }
+
+    axis.lut = Pixels->lut;
+
+    axis.start.x = f_math_max(Start.x, f__screen.clipStart.x);
+    axis.start.y = f_math_max(Start.y, f__screen.clipStart.y);
+    axis.end.x = f_math_min(End.x, f__screen.clipEnd.x);
+    axis.end.y = f_math_min(End.y, f__screen.clipEnd.y);
+
+    axis.startU = axis.incU * (axis.start.x - Start.x);
+    axis.startV = axis.incV * (axis.start.y - Start.y);
+
+    g_blittersAxis
+        [f_pixels__isIndexed(Pixels)]
+        [f__color.blend]
+        [f__color.fillBlit]
+        [keyed]
+            (&axis);
+}
+
 void f_platform_api_software__textureBlitEx(const FPlatformTexture* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y, FFix Scale, unsigned Angle, FFix CenterX, FFix CenterY)
 {
     const FVecInt size = Pixels->size;
@@ -563,6 +780,25 @@ void f_platform_api_software__textureBlitEx(const FPlatformTexture* Texture, con
         return;
     }
 
+    int yTop = f_math_max(screenTop.y, f__screen.clipStart.y);
+    int yBottom = f_math_min(screenBottom.y, f__screen.clipEnd.y - 1);
+
+    f_screen__damageAdd(screenLeft.x,
+                        yTop,
+                        screenRight.x - screenLeft.x + 1,
+                        yBottom - yTop + 1);
+
+    if(Angle % F_DEG_090_INT == 0) {
+        blitAxis(Texture,
+                 Pixels,
+                 Frame,
+                 Angle,
+                 (FVecInt){screenLeft.x, screenTop.y},
+                 (FVecInt){screenRight.x + 1, screenBottom.y + 1});
+
+        return;
+    }
+
     scan_line(
         &g_edges[0], screenTop, screenLeft, spriteTop, spriteMidleft);
     scan_line(
@@ -572,10 +808,8 @@ void f_platform_api_software__textureBlitEx(const FPlatformTexture* Texture, con
     scan_line(
         &g_edges[1], screenRight, screenBottom, spriteMidright, spriteBottom);
 
-    int yTop = f_math_max(screenTop.y, f__screen.clipStart.y);
-    int yBottom = f_math_min(screenBottom.y, f__screen.clipEnd.y - 1);
-
     g_blittersEx
+        [f_pixels__isIndexed(Pixels)]
         [f__color.blend]
         [f__color.fillBlit]
         [Texture != NULL]
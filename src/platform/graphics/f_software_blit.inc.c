@@ -18,18 +18,60 @@
 #include "../../general/f_system_includes.h"
 
 #ifdef F__BLEND
+// Draw a run of Len visible pixels and advance dst (and src)
+#if defined(F__SPAN_DRAW) && !F__SRC_INDEXED
+    #ifdef F__PIXEL_USE_SRC
+        #define F__SPAN(Len)       \
+            do {                   \
+                F__SPAN_DRAW(Len); \
+                dst += (Len);      \
+                src += (Len);      \
+            } while(0)
+    #else
+        #define F__SPAN(Len)       \
+            do {                   \
+                F__SPAN_DRAW(Len); \
+                dst += (Len);      \
+            } while(0)
+    #endif
+#else
+    #ifdef F__PIXEL_USE_SRC
+        #define F__SPAN(Len)                        \
+            for(int f__len = (Len); f__len--; ) {   \
+                F__PIXEL_SETUP;                     \
+                F__PIXEL_DRAW(dst);                 \
+                dst++;                              \
+                src++;                              \
+            }
+    #else
+        #define F__SPAN(Len)                        \
+            for(int f__len = (Len); f__len--; ) {   \
+                F__PIXEL_SETUP;                     \
+                F__PIXEL_DRAW(dst);                 \
+                dst++;                              \
+            }
+    #endif
+#endif
+
+#if F__SRC_INDEXED && defined(F__PIXEL_USE_SRC)
+    #define F__SRC_SETUP(Lut) const FColorPixel* const lut = Lut;
+#else
+    #define F__SRC_SETUP(Lut)
+#endif
+
 // Spans format for each graphic line:
 // [NumSpans << 1 | 1 (draw) / 0 (transparent)][[len]...]
 static void F__FUNC_NAME(Keyed, NoClip)(const FTextureSoft* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y)
 {
     F__BLEND_SETUP;
+    F__SRC_SETUP(Pixels->lut);
 
     const int screenW = f__screen.pixels->size.x;
     FColorPixel* startDst = f_screen__bufferGetFrom(X, Y);
 #ifdef F__PIXEL_USE_SRC
-    const FColorPixel* src = f_pixels__bufferGetStartConst(Pixels, Frame);
+    const F__SRC_T* src = F__SRC_START(Pixels, Frame);
 #endif
-    const FSpriteWord* spans = Texture->spans[Frame];
+    const FSpriteWord* spans = Texture->frames[Frame].spans;
 
     for(int i = Pixels->size.y; i--; startDst += screenW) {
         bool draw = *spans & 1;
@@ -40,14 +82,7 @@ static void F__FUNC_NAME(Keyed, NoClip)(const FTextureSoft* Texture, const FPixe
             int len = (int)*spans++;
 
             if(draw) {
-                while(len--) {
-                    F__PIXEL_SETUP;
-                    F__PIXEL_DRAW(dst);
-                    dst++;
-#ifdef F__PIXEL_USE_SRC
-                    src++;
-#endif
-                }
+                F__SPAN(len);
             } else {
                 dst += len;
 #ifdef F__PIXEL_USE_SRC
@@ -63,6 +98,7 @@ static void F__FUNC_NAME(Keyed, NoClip)(const FTextureSoft* Texture, const FPixe
 static void F__FUNC_NAME(Keyed, DoClip)(const FTextureSoft* Texture, const FPixels* Pixels, unsigned Frame, int X, int Y)
 {
     F__BLEND_SETUP;
+    F__SRC_SETUP(Pixels->lut);
 
     const int screenW = f__screen.pixels->size.x;
     const int spriteW = Pixels->size.x;
@@ -78,24 +114,49 @@ static void F__FUNC_NAME(Keyed, DoClip)(const FTextureSoft* Texture, const FPixe
 
     FColorPixel* startDst = f_screen__bufferGetFrom(X + xClipLeft, Y + yClipUp);
 #ifdef F__PIXEL_USE_SRC
-    const FColorPixel* startSrc =
-        f_pixels__bufferGetFromConst(Pixels, Frame, xClipLeft, yClipUp);
+    const F__SRC_T* startSrc =
+        F__SRC_FROM(Pixels, Frame, xClipLeft, yClipUp);
 #endif
 
-    const FSpriteWord* spans = Texture->spans[Frame];
-
-    // skip clipped top rows
-    for(int i = yClipUp; i--; ) {
-        spans += 1 + (*spans >> 1);
+    const FSpriteWord* spansStart = Texture->frames[Frame].spans;
+    const FSpriteWord* spans = spansStart;
+    const FSpansRow* index = Texture->frames[Frame].rows;
+
+    if(index) {
+        // jump to the first visible row
+        index += yClipUp;
+    } else {
+        // skip clipped top rows
+        for(int i = yClipUp; i--; ) {
+            spans += 1 + (*spans >> 1);
+        }
     }
 
     // draw visible rows
     for(int i = rows; i--; ) {
+        if(index) {
+            spans = spansStart + index->offset;
+
+            // nothing to draw between the clipped columns
+            if((int)index->opaqueEnd <= xClipLeft
+                || (int)index->opaqueStart >= xClipLeft + columns) {
+
+                index++;
+                startDst += screenW;
+#ifdef F__PIXEL_USE_SRC
+                startSrc += spriteW;
+#endif
+                continue;
+            }
+
+            index++;
+        }
+
         bool draw = *spans & 1;
         const FSpriteWord* nextLine = spans + 1 + (*spans >> 1);
         FColorPixel* dst = startDst;
 #ifdef F__PIXEL_USE_SRC
-        const FColorPixel* src = startSrc;
+        const F__SRC_T* src = startSrc;
 #endif
         int clippedLen = 0;
         int drawColumns = columns;
@@ -118,14 +179,10 @@ static void F__FUNC_NAME(Keyed, DoClip)(const FTextureSoft* Texture, const FPixe
 #endif
                 drawColumns -= len;
             } else {
-                while(len-- && drawColumns--) {
-                    F__PIXEL_SETUP;
-                    F__PIXEL_DRAW(dst);
-                    dst++;
-#ifdef F__PIXEL_USE_SRC
-                    src++;
-#endif
-                }
+                len = f_math_min(len, drawColumns);
+                drawColumns -= len;
+
+                F__SPAN(len);
             }
         }
 
@@ -134,14 +191,10 @@ static void F__FUNC_NAME(Keyed, DoClip)(const FTextureSoft* Texture, const FPixe
             int len = (int)*++spans;
 
             if(draw) {
-                while(len-- && drawColumns--) {
-                    F__PIXEL_SETUP;
-                    F__PIXEL_DRAW(dst);
-                    dst++;
-#ifdef F__PIXEL_USE_SRC
-                    src++;
-#endif
-                }
+                len = f_math_min(len, drawColumns);
+                drawColumns -= len;
+
+                F__SPAN(len);
             } else {
                 dst += len;
 #ifdef F__PIXEL_USE_SRC
@@ -168,11 +221,12 @@ static void F__FUNC_NAME(Block, NoClip)(const FTextureSoft* Texture, const FPixe
     F_UNUSED(Texture);
 
     F__BLEND_SETUP;
+    F__SRC_SETUP(Pixels->lut);
 
     const int screenW = f__screen.pixels->size.x;
     FColorPixel* startDst = f_screen__bufferGetFrom(X, Y);
 #ifdef F__PIXEL_USE_SRC
-    const FColorPixel* src = f_pixels__bufferGetStartConst(Pixels, Frame);
+    const F__SRC_T* src = F__SRC_START(Pixels, Frame);
 #else
     F_UNUSED(Frame);
 #endif
@@ -180,14 +234,7 @@ static void F__FUNC_NAME(Block, NoClip)(const FTextureSoft* Texture, const FPixe
     for(int i = Pixels->size.y; i--; startDst += screenW) {
         FColorPixel* dst = startDst;
 
-        for(int j = Pixels->size.x; j--; ) {
-            F__PIXEL_SETUP;
-            F__PIXEL_DRAW(dst);
-            dst++;
-#ifdef F__PIXEL_USE_SRC
-            src++;
-#endif
-        }
+        F__SPAN(Pixels->size.x);
     }
 }
 
@@ -196,6 +243,7 @@ static void F__FUNC_NAME(Block, DoClip)(const FTextureSoft* Texture, const FPixe
     F_UNUSED(Texture);
 
     F__BLEND_SETUP;
+    F__SRC_SETUP(Pixels->lut);
 
     const int screenW = f__screen.pixels->size.x;
     const int spriteW = Pixels->size.x;
@@ -211,8 +259,8 @@ static void F__FUNC_NAME(Block, DoClip)(const FTextureSoft* Texture, const FPixe
 
     FColorPixel* startDst = f_screen__bufferGetFrom(X + xClipLeft, Y + yClipUp);
 #ifdef F__PIXEL_USE_SRC
-    const FColorPixel* startSrc =
-        f_pixels__bufferGetFromConst(Pixels, Frame, xClipLeft, yClipUp);
+    const F__SRC_T* startSrc =
+        F__SRC_FROM(Pixels, Frame, xClipLeft, yClipUp);
 #else
     F_UNUSED(Frame);
 #endif
@@ -220,17 +268,10 @@ static void F__FUNC_NAME(Block, DoClip)(const FTextureSoft* Texture, const FPixe
     for(int i = rows; i--; ) {
         FColorPixel* dst = startDst;
 #ifdef F__PIXEL_USE_SRC
-        const FColorPixel* src = startSrc;
+        const F__SRC_T* src = startSrc;
 #endif
 
-        for(int j = columns; j--; ) {
-            F__PIXEL_SETUP;
-            F__PIXEL_DRAW(dst);
-            dst++;
-#ifdef F__PIXEL_USE_SRC
-            src++;
-#endif
-        }
+        F__SPAN(columns);
 
         startDst += screenW;
 #ifdef F__PIXEL_USE_SRC
@@ -245,10 +286,13 @@ static void F__FUNC_NAME(Block, DoClip)(const FTextureSoft* Texture, const FPixe
 #define F__PIXEL_TRANSPARENCY 1
 #include "f_software_blitex.inc.c"
 
-#undef F__BLEND
-#undef F__FILL
-#undef F__BLEND_SETUP
-#undef F__PIXEL_USE_SRC
-#undef F__PIXEL_SETUP
-#undef F__PIXEL_PARAMS
+#undef F__SRC_INDEXED
+#undef F__SRC_NAME
+#undef F__SRC_T
+#undef F__SRC_START
+#undef F__SRC_FROM
+#undef F__SRC_PIXEL
+#undef F__SRC_IS_KEY
+#undef F__SRC_SETUP
+#undef F__SPAN
 #endif // F__BLEND
@@ -26,6 +26,28 @@
     typedef unsigned FSpriteWord;
 #endif
 
+// Index each sprite row's spans, so clipped blits can jump to the first
+// visible row and skip rows that are blank in the visible columns
+#define F_SOFTWARE_BLIT__SPANS_INDEX !F_CONFIG_TRAIT_LOW_MEM
+
+// Embedded sprites only reference their generated rows index if it is used
+#if F_SOFTWARE_BLIT__SPANS_INDEX
+    #define F_SOFTWARE_BLIT__ROWS(Rows) ((FSpansRow*)(Rows))
+#else
+    #define F_SOFTWARE_BLIT__ROWS(Rows) NULL
+#endif
+
+// Where a sprite row's spans start, and the columns it draws to
+typedef struct {
+    unsigned offset; // index of the row's first word in the frame's spans
+    FSpriteWord opaqueStart, opaqueEnd; // [start, end), both 0 if empty
+} FSpansRow;
+
+typedef struct {
+    FSpriteWord* spans; // NULL if the frame has no transparent pixels
+    FSpansRow* rows; // [height], or NULL to walk the spans row by row
+} FTextureSoftFrame;
+
 #include "../f_platform.v.h"
 
 extern void f_platform_software_blit__init(void);
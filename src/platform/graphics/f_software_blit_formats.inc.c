@@ -0,0 +1,48 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../general/f_system_includes.h"
+
+#ifdef F__BLEND
+// Native pixels
+#define F__SRC_INDEXED 0
+#define F__SRC_NAME(Name) Name##__
+#define F__SRC_T FColorPixel
+#define F__SRC_START f_pixels__bufferGetStartConst
+#define F__SRC_FROM f_pixels__bufferGetFromConst
+#define F__SRC_PIXEL (*src)
+#define F__SRC_IS_KEY(Src) (*(Src) == f_color__key)
+#include "f_software_blit.inc.c"
+
+// 8-bit indices, expanded through the sprite's lut as they are drawn
+#define F__SRC_INDEXED 1
+#define F__SRC_NAME(Name) Name##Indexed__
+#define F__SRC_T uint8_t
+#define F__SRC_START f_pixels__indicesGetStartConst
+#define F__SRC_FROM f_pixels__indicesGetFromConst
+#define F__SRC_PIXEL (lut[*src])
+#define F__SRC_IS_KEY(Src) (*(Src) == 0)
+#include "f_software_blit.inc.c"
+
+#undef F__BLEND
+#undef F__FILL
+#undef F__BLEND_SETUP
+#undef F__PIXEL_USE_SRC
+#undef F__PIXEL_SETUP
+#undef F__PIXEL_PARAMS
+#undef F__SPAN_DRAW
+#endif // F__BLEND
@@ -27,11 +27,11 @@
 static void F__FUNC_NAME_EX(const FPixels* Pixels, unsigned Frame, int TopY, int BottomY)
 {
     F__BLEND_SETUP;
+    F__SRC_SETUP(Pixels->lut);
 
     const FVecInt screenSize = f_screen_sizeGet();
     FColorPixel* const screenPixels = f_screen__bufferGetFrom(0, 0);
-    const FColorPixel* const pixels =
-        f_pixels__bufferGetFromConst(Pixels, Frame, 0, 0);
+    const F__SRC_T* const pixels = F__SRC_START(Pixels, Frame);
     const FVecInt size = Pixels->size;
 
     for(int scrY = TopY; scrY <= BottomY; scrY++) {
@@ -74,11 +74,11 @@ static void F__FUNC_NAME_EX(const FPixels* Pixels, unsigned Frame, int TopY, int
         FColorPixel* dst = screenPixels + scrY * screenSize.x + screenX0;
 
         for(int x = screenX0; x <= screenX1; x++) {
-            const FColorPixel* src =
+            const F__SRC_T* src =
                 pixels + f_fix_toInt(sprite.y) * size.x + f_fix_toInt(sprite.x);
 
             #if F__PIXEL_TRANSPARENCY
-                if(*src != f_color__key) {
+                if(!F__SRC_IS_KEY(src)) {
                     F__PIXEL_SETUP;
                     F__PIXEL_DRAW(dst);
                 }
@@ -97,6 +97,64 @@ static void F__FUNC_NAME_EX(const FPixels* Pixels, unsigned Frame, int TopY, int
     }
 }
 
+// Nearest-neighbor sampling along the sprite's two axes, used for flips,
+// 90deg rotations and any scale, same sampling as the function above
+static void F__FUNC_NAME_AXIS(const FBlitAxis* Axis)
+{
+    F__BLEND_SETUP;
+    F__SRC_SETUP(Axis->lut);
+
+    const int screenW = f__screen.pixels->size.x;
+    const int columns = Axis->end.x - Axis->start.x;
+    FColorPixel* startDst = f_screen__bufferGetFrom(Axis->start.x,
+                                                    Axis->start.y);
+    FFix v = Axis->startV;
+
+#if !F__PIXEL_TRANSPARENCY
+    // Sprite rows drawn left to right at 1:1 are straight copies
+    const bool unit = Axis->strideU == 1 && Axis->incU == F_FIX_ONE;
+#endif
+
+    for(int i = Axis->end.y - Axis->start.y; i--; startDst += screenW) {
+        const F__SRC_T* const line =
+            (const F__SRC_T*)Axis->origin + f_fix_toInt(v) * Axis->strideV;
+        FColorPixel* dst = startDst;
+        FFix u = Axis->startU;
+
+        v += Axis->incV;
+
+        #if !F__PIXEL_TRANSPARENCY
+            if(unit) {
+                const F__SRC_T* src = line + f_fix_toInt(u);
+                F_UNUSED(src);
+
+                F__SPAN(columns);
+
+                continue;
+            }
+        #endif
+
+        for(int x = columns; x--; ) {
+            const F__SRC_T* src = line + f_fix_toInt(u) * Axis->strideU;
+
+            #if F__PIXEL_TRANSPARENCY
+                if(!F__SRC_IS_KEY(src)) {
+                    F__PIXEL_SETUP;
+                    F__PIXEL_DRAW(dst);
+                }
+            #else
+                F_UNUSED(src);
+
+                F__PIXEL_SETUP;
+                F__PIXEL_DRAW(dst);
+            #endif
+
+            dst++;
+            u += Axis->incU;
+        }
+    }
+}
+
 #undef F__PIXEL_TRANSPARENCY
 #undef F__COLORKEY
 #endif // F__BLEND
@@ -20,9 +20,11 @@
 
 #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
 typedef void (*FCallDrawPixel)(int X, int Y);
+typedef void (*FCallDrawPixels)(const FVecInt* Points, unsigned Num);
 typedef void (*FCallDrawHLine)(int X1, int X2, int Y);
 typedef void (*FCallDrawVLine)(int X, int Y1, int Y2);
 typedef void (*FCallDrawLine)(int X1, int Y1, int X2, int Y2);
+typedef void (*FCallDrawLineRows)(int X1, int Y1, int X2, int Y2, int RowStart, int RowEnd);
 typedef void (*FCallDrawRectangle)(int X, int Y, int Width, int Height);
 typedef void (*FCallDrawCircle)(int X, int Y, int Radius);
 
@@ -253,9 +255,12 @@ do {                                                                        \
 #define F__INIT_BLEND(Index, Name)                           \
     [Index] = {                                              \
         .pixel = f_draw__pixel_##Name,                       \
+        .pixels[0] = f_draw__pixels_noclip_##Name,           \
+        .pixels[1] = f_draw__pixels_clip_##Name,             \
         .hline = f_draw__hline_##Name,                       \
         .vline = f_draw__vline_##Name,                       \
         .line = f_draw__line_##Name,                         \
+        .lineRows = f_draw__line_rows_##Name,                \
         .rectangle[0] = f_draw__rectangle_nofill_##Name,     \
         .rectangle[1] = f_draw__rectangle_fill_##Name,       \
         .circle[0][0] = f_draw__circle_noclip_nofill_##Name, \
@@ -266,9 +271,11 @@ do {                                                                        \
 
 static const struct {
     FCallDrawPixel pixel;
+    FCallDrawPixels pixels[2]; // [Clip]
     FCallDrawHLine hline;
     FCallDrawVLine vline;
     FCallDrawLine line;
+    FCallDrawLineRows lineRows;
     FCallDrawRectangle rectangle[2]; // [Fill]
     FCallDrawCircle circle[2][2]; // [Clip][Fill]
 } g_draw[F_COLOR_BLEND_NUM] = {
@@ -293,9 +300,42 @@ void f_platform_api_software__drawPixel(int X, int Y)
 {
     if(f_screen_boxInsideClip(X, Y, 1, 1)) {
         g_draw[f__color.blend].pixel(X, Y);
+        f_screen__damageAdd(X, Y, 1, 1);
     }
 }
 
+// One clip test and damage area for the whole batch, from its bounding box
+void f_platform_api_software__drawPixels(const FVecInt* Points, unsigned Num)
+{
+    if(Num == 0) {
+        return;
+    }
+
+    FVecInt min = Points[0];
+    FVecInt max = Points[0];
+
+    for(unsigned i = Num; --i; ) {
+        const FVecInt p = Points[i];
+
+        min.x = f_math_min(min.x, p.x);
+        min.y = f_math_min(min.y, p.y);
+        max.x = f_math_max(max.x, p.x);
+        max.y = f_math_max(max.y, p.y);
+    }
+
+    const int w = max.x - min.x + 1;
+    const int h = max.y - min.y + 1;
+
+    if(!f_screen_boxOnClip(min.x, min.y, w, h)) {
+        return;
+    }
+
+    g_draw[f__color.blend].pixels[!f_screen_boxInsideClip(min.x, min.y, w, h)]
+        (Points, Num);
+
+    f_screen__damageAdd(min.x, min.y, w, h);
+}
+
 void f_platform_api_software__drawLine(int X1, int Y1, int X2, int Y2)
 {
     int x = f_math_min(X1, X2);
@@ -310,6 +350,62 @@ void f_platform_api_software__drawLine(int X1, int Y1, int X2, int Y2)
     }
 
     g_draw[f__color.blend].line(X1, Y1, X2, Y2);
+
+    f_screen__damageAdd(f_math_min(X1, X2),
+                        f_math_min(Y1, Y2),
+                        f_math_abs(X2 - X1) + 1,
+                        f_math_abs(Y2 - Y1) + 1);
+}
+
+void f_platform_software_draw__lineRows(int X1, int Y1, int X2, int Y2, int RowStart, int RowEnd)
+{
+    int x = f_math_min(X1, X2);
+    int y = f_math_min(Y1, Y2);
+    int w = f_math_abs(X2 - X1) + 1;
+    int h = f_math_abs(Y2 - Y1) + 1;
+
+    if(!f_screen_boxOnClip(x, y, w, h)
+        || !cohen_sutherland_clip(&X1, &Y1, &X2, &Y2)) {
+
+        return;
+    }
+
+    g_draw[f__color.blend].lineRows(X1, Y1, X2, Y2, RowStart, RowEnd);
+}
+
+void f_platform_api_software__drawLines(const FVecInt* Points, unsigned Num)
+{
+    const FCallDrawLine line = g_draw[f__color.blend].line;
+    FVecInt min = {INT_MAX, INT_MAX};
+    FVecInt max = {INT_MIN, INT_MIN};
+
+    for(unsigned i = Num; i--; Points += 2) {
+        int x1 = Points[0].x;
+        int y1 = Points[0].y;
+        int x2 = Points[1].x;
+        int y2 = Points[1].y;
+
+        if(!f_screen_boxOnClip(f_math_min(x1, x2),
+                               f_math_min(y1, y2),
+                               f_math_abs(x2 - x1) + 1,
+                               f_math_abs(y2 - y1) + 1)
+            || !cohen_sutherland_clip(&x1, &y1, &x2, &y2)) {
+
+            continue;
+        }
+
+        line(x1, y1, x2, y2);
+
+        min.x = f_math_min(min.x, f_math_min(x1, x2));
+        min.y = f_math_min(min.y, f_math_min(y1, y2));
+        max.x = f_math_max(max.x, f_math_max(x1, x2));
+        max.y = f_math_max(max.y, f_math_max(y1, y2));
+    }
+
+    if(min.x <= max.x) {
+        f_screen__damageAdd(
+            min.x, min.y, max.x - min.x + 1, max.y - min.y + 1);
+    }
 }
 
 void f_platform_api_software__drawLineH(int X1, int X2, int Y)
@@ -322,6 +418,7 @@ void f_platform_api_software__drawLineH(int X1, int X2, int Y)
     X2 = f_math_min(X2, f__screen.clipEnd.x - 1);
 
     g_draw[f__color.blend].hline(X1, X2, Y);
+    f_screen__damageAdd(X1, Y, X2 - X1 + 1, 1);
 }
 
 void f_platform_api_software__drawLineV(int X, int Y1, int Y2)
@@ -334,6 +431,7 @@ void f_platform_api_software__drawLineV(int X, int Y1, int Y2)
     Y2 = f_math_min(Y2, f__screen.clipEnd.y - 1);
 
     g_draw[f__color.blend].vline(X, Y1, Y2);
+    f_screen__damageAdd(X, Y1, 1, Y2 - Y1 + 1);
 }
 
 static void drawRectangle(int X, int Y, int Width, int Height)
@@ -342,6 +440,8 @@ static void drawRectangle(int X, int Y, int Width, int Height)
         return;
     }
 
+    f_screen__damageAdd(X, Y, Width, Height);
+
     if(f_screen_boxInsideClip(X, Y, Width, Height)) {
         g_draw[f__color.blend].rectangle[f__color.fillDraw]
             (X, Y, Width, Height);
@@ -370,6 +470,57 @@ void f_platform_api_software__drawRectangleFilled(int X, int Y, int Width, int H
     drawRectangle(X, Y, Width, Height);
 }
 
+static void drawRectangles(const FVecInt* Rects, unsigned Num)
+{
+    const FCallDrawRectangle rectangle =
+        g_draw[f__color.blend].rectangle[f__color.fillDraw];
+    FVecInt min = {INT_MAX, INT_MAX};
+    FVecInt max = {INT_MIN, INT_MIN};
+
+    for(unsigned i = Num; i--; Rects += 2) {
+        int x = Rects[0].x;
+        int y = Rects[0].y;
+        int w = Rects[1].x;
+        int h = Rects[1].y;
+
+        if(!f_screen_boxOnClip(x, y, w, h)) {
+            continue;
+        }
+
+        if(!f_screen_boxInsideClip(x, y, w, h)) {
+            // Same clipping as drawRectangle
+            const int x2 = f_math_min(x + w, f__screen.clipEnd.x);
+            const int y2 = f_math_min(y + h, f__screen.clipEnd.y);
+
+            x = f_math_max(x, f__screen.clipStart.x);
+            y = f_math_max(y, f__screen.clipStart.y);
+            w = f_math_min(w, x2 - x);
+            h = f_math_min(h, y2 - y);
+        }
+
+        rectangle(x, y, w, h);
+
+        min.x = f_math_min(min.x, x);
+        min.y = f_math_min(min.y, y);
+        max.x = f_math_max(max.x, x + w);
+        max.y = f_math_max(max.y, y + h);
+    }
+
+    if(min.x < max.x) {
+        f_screen__damageAdd(min.x, min.y, max.x - min.x, max.y - min.y);
+    }
+}
+
+void f_platform_api_software__drawRectanglesOutline(const FVecInt* Rects, unsigned Num)
+{
+    drawRectangles(Rects, Num);
+}
+
+void f_platform_api_software__drawRectanglesFilled(const FVecInt* Rects, unsigned Num)
+{
+    drawRectangles(Rects, Num);
+}
+
 static void drawCircle(int X, int Y, int Radius)
 {
     int boxX = X - Radius;
@@ -381,6 +532,8 @@ static void drawCircle(int X, int Y, int Radius)
             [!f_screen_boxInsideClip(boxX, boxY, boxDim, boxDim)]
             [f__color.fillDraw]
                 (X, Y, Radius);
+
+        f_screen__damageAdd(boxX, boxY, boxDim, boxDim);
     }
 }
 
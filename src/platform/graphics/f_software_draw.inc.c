@@ -25,6 +25,36 @@ static void F__FUNC_NAME(pixel)(int X, int Y)
     F__PIXEL_DRAW(f_screen__bufferGetFrom(X, Y));
 }
 
+static void F__FUNC_NAME(pixels_noclip)(const FVecInt* Points, unsigned Num)
+{
+    F__BLEND_SETUP;
+
+    FColorPixel* const pixels = f_screen__bufferGetFrom(0, 0);
+    const int screenw = f__screen.pixels->size.x;
+
+    for(unsigned i = Num; i--; Points++) {
+        F__PIXEL_DRAW(pixels + Points->y * screenw + Points->x);
+    }
+}
+
+static void F__FUNC_NAME(pixels_clip)(const FVecInt* Points, unsigned Num)
+{
+    F__BLEND_SETUP;
+
+    FColorPixel* const pixels = f_screen__bufferGetFrom(0, 0);
+    const int screenw = f__screen.pixels->size.x;
+    const FVecInt clipStart = f__screen.clipStart;
+    const FVecInt clipEnd = f__screen.clipEnd;
+
+    for(unsigned i = Num; i--; Points++) {
+        if(Points->x >= clipStart.x && Points->x < clipEnd.x
+            && Points->y >= clipStart.y && Points->y < clipEnd.y) {
+
+            F__PIXEL_DRAW(pixels + Points->y * screenw + Points->x);
+        }
+    }
+}
+
 static void F__FUNC_NAME(hline)(int X1, int X2, int Y)
 {
     F__BLEND_SETUP;
@@ -48,66 +78,73 @@ static void F__FUNC_NAME(vline)(int X, int Y1, int Y2)
     }
 }
 
-static void F__FUNC_NAME(line)(int X1, int Y1, int X2, int Y2)
+// Steps the whole line but only plots the pixels on rows [RowStart, RowEnd),
+// so a line split across screen bands touches the same pixels as a whole one
+static void F__FUNC_NAME(line_rows)(int X1, int Y1, int X2, int Y2, int RowStart, int RowEnd)
 {
     F__BLEND_SETUP;
 
-    const int xmin = f_math_min(X1, X2);
-    const int xmax = f_math_max(X1, X2);
-    const int ymin = f_math_min(Y1, Y2);
-    const int ymax = f_math_max(Y1, Y2);
+    const int deltax = f_math_abs(X2 - X1);
+    const int deltay = f_math_abs(Y2 - Y1);
 
-    if(X1 == X2) {
-        F__FUNC_NAME(vline)(X1, ymin, ymax);
-    } else if(Y1 == Y2) {
-        F__FUNC_NAME(hline)(xmin, xmax, Y1);
-    } else {
-        const int deltax = xmax - xmin;
-        const int deltay = ymax - ymin;
-
-        const int denominator = f_math_max(deltax, deltay);
-        const int numeratorinc = f_math_min(deltax, deltay);
-        int numerator = denominator / 2;
+    const int denominator = f_math_max(deltax, deltay);
+    const int numeratorinc = f_math_min(deltax, deltay);
+    int numerator = denominator / 2;
 
-        const int xinct = (X1 <= X2) ? 1 : -1;
-        const int yinct = (Y1 <= Y2) ? 1 : -1;
+    const int xinct = (X1 <= X2) ? 1 : -1;
+    const int yinct = (Y1 <= Y2) ? 1 : -1;
 
-        const int xinc1 = (denominator == deltax) ? xinct : 0;
-        const int yinc1 = (denominator == deltax) ? 0 : yinct;
+    const int xinc1 = (denominator == deltax) ? xinct : 0;
+    const int yinc1 = (denominator == deltax) ? 0 : yinct;
 
-        const int xinc2 = (denominator == deltax) ? 0 : xinct;
-        const int yinc2 = (denominator == deltax) ? yinct : 0;
+    const int xinc2 = (denominator == deltax) ? 0 : xinct;
+    const int yinc2 = (denominator == deltax) ? yinct : 0;
 
-        const int screenw = f__screen.pixels->size.x;
-        FColorPixel* dst1 = f_screen__bufferGetFrom(X1, Y1);
-        FColorPixel* dst2 = f_screen__bufferGetFrom(X2, Y2);
+    const int screenw = f__screen.pixels->size.x;
+    FColorPixel* dst1 = f_screen__bufferGetFrom(X1, Y1);
+    FColorPixel* dst2 = f_screen__bufferGetFrom(X2, Y2);
+    int y1 = Y1;
+    int y2 = Y2;
 
-        for(int i = (denominator + 1) / 2; i--; ) {
+    for(int i = (denominator + 1) / 2; i--; ) {
+        if(y1 >= RowStart && y1 < RowEnd) {
             F__PIXEL_DRAW(dst1);
-            F__PIXEL_DRAW(dst2);
+        }
 
-            numerator += numeratorinc;
+        if(y2 >= RowStart && y2 < RowEnd) {
+            F__PIXEL_DRAW(dst2);
+        }
 
-            if(numerator >= denominator) {
-                numerator -= denominator;
+        numerator += numeratorinc;
 
-                dst1 += xinc2;
-                dst1 += yinc2 * screenw;
+        if(numerator >= denominator) {
+            numerator -= denominator;
 
-                dst2 -= xinc2;
-                dst2 -= yinc2 * screenw;
-            }
+            dst1 += xinc2 + yinc2 * screenw;
+            dst2 -= xinc2 + yinc2 * screenw;
+            y1 += yinc2;
+            y2 -= yinc2;
+        }
 
-            dst1 += xinc1;
-            dst1 += yinc1 * screenw;
+        dst1 += xinc1 + yinc1 * screenw;
+        dst2 -= xinc1 + yinc1 * screenw;
+        y1 += yinc1;
+        y2 -= yinc1;
+    }
 
-            dst2 -= xinc1;
-            dst2 -= yinc1 * screenw;
-        }
+    if((denominator & 1) == 0 && y1 >= RowStart && y1 < RowEnd) {
+        F__PIXEL_DRAW(dst1);
+    }
+}
 
-        if((denominator & 1) == 0) {
-            F__PIXEL_DRAW(dst1);
-        }
+static void F__FUNC_NAME(line)(int X1, int Y1, int X2, int Y2)
+{
+    if(X1 == X2) {
+        F__FUNC_NAME(vline)(X1, f_math_min(Y1, Y2), f_math_max(Y1, Y2));
+    } else if(Y1 == Y2) {
+        F__FUNC_NAME(hline)(f_math_min(X1, X2), f_math_max(X1, X2), Y1);
+    } else {
+        F__FUNC_NAME(line_rows)(X1, Y1, X2, Y2, INT_MIN, INT_MAX);
     }
 }
 
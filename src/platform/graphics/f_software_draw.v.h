@@ -22,12 +22,18 @@
 
 #include "../f_platform.v.h"
 
+extern void f_platform_software_draw__lineRows(int X1, int Y1, int X2, int Y2, int RowStart, int RowEnd);
+
 extern FCallApi_DrawPixel f_platform_api_software__drawPixel;
+extern FCallApi_DrawPixels f_platform_api_software__drawPixels;
 extern FCallApi_DrawLine f_platform_api_software__drawLine;
+extern FCallApi_DrawLines f_platform_api_software__drawLines;
 extern FCallApi_DrawLineH f_platform_api_software__drawLineH;
 extern FCallApi_DrawLineV f_platform_api_software__drawLineV;
 extern FCallApi_DrawRectangleOutline f_platform_api_software__drawRectangleOutline;
 extern FCallApi_DrawRectangleFilled f_platform_api_software__drawRectangleFilled;
+extern FCallApi_DrawRectanglesOutline f_platform_api_software__drawRectanglesOutline;
+extern FCallApi_DrawRectanglesFilled f_platform_api_software__drawRectanglesFilled;
 extern FCallApi_DrawCircleOutline f_platform_api_software__drawCircleOutline;
 extern FCallApi_DrawCircleFilled f_platform_api_software__drawCircleFilled;
 
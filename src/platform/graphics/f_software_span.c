@@ -0,0 +1,286 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_software_span.v.h"
+#include <faur.v.h>
+
+#if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+// The rgb kernels unpack each channel to its own lanes, so the 5551 and
+// byte-swapped formats only get the scalar loops.
+#if !F_PIXELS_VEC__SIMD
+    #define F__SPAN_SIMD 0
+#elif F_CONFIG_SCREEN_FORMAT == F_COLOR_FORMAT_RGB_565
+    #define F__SPAN_SIMD 1
+#elif F_CONFIG_SCREEN_FORMAT & F__C_8888
+    #define F__SPAN_SIMD 1
+#else
+    #define F__SPAN_SIMD 0
+#endif
+
+#if F__SPAN_SIMD
+#define F__VEC_LANES F_PIXELS_VEC__LANES
+
+// Vector loops cover the first F__VEC_DONE(Len) pixels of a span
+#define F__VEC_DONE(Len) F_PIXELS_VEC__DONE(Len)
+
+// Channels are unpacked to 0-255 like FColorRgb, one pixel per lane
+typedef struct {
+    FVecPixels r, g, b;
+} FVecRgb;
+
+static inline FVecRgb vecToRgb(FVecPixels Pixels)
+{
+    FVecRgb rgb = {
+        ((Pixels >> F__PX_SHIFT_R) << F__PX_PACK_R) & 0xff,
+        ((Pixels >> F__PX_SHIFT_G) << F__PX_PACK_G) & 0xff,
+        ((Pixels >> F__PX_SHIFT_B) << F__PX_PACK_B) & 0xff
+    };
+
+    return rgb;
+}
+
+static inline FVecRgb vecToRgbSplat(const FColorRgb* Rgb)
+{
+    FVecRgb rgb = {
+        f_pixels_vec__splat((FColorPixel)Rgb->r),
+        f_pixels_vec__splat((FColorPixel)Rgb->g),
+        f_pixels_vec__splat((FColorPixel)Rgb->b)
+    };
+
+    return rgb;
+}
+
+static inline FVecPixels vecFromRgb(FVecRgb Rgb)
+{
+    return ((Rgb.r >> F__PX_PACK_R) << F__PX_SHIFT_R)
+         | ((Rgb.g >> F__PX_PACK_G) << F__PX_SHIFT_G)
+         | ((Rgb.b >> F__PX_PACK_B) << F__PX_SHIFT_B);
+}
+
+// Same as Dst + (((Src - Dst) * Alpha) >> 8), without negative terms
+static inline FVecRgb vecAlpha(FVecRgb Dst, const FVecRgb* Src, FVecPixels Alpha, FVecPixels AlphaInv)
+{
+    Dst.r = (Dst.r * AlphaInv + Src->r * Alpha) >> 8;
+    Dst.g = (Dst.g * AlphaInv + Src->g * Alpha) >> 8;
+    Dst.b = (Dst.b * AlphaInv + Src->b * Alpha) >> 8;
+
+    return Dst;
+}
+
+static inline FVecRgb vecAlpha25(FVecRgb Dst, const FVecRgb* Src)
+{
+    Dst.r = Dst.r - (Dst.r >> 2) + (Src->r >> 2);
+    Dst.g = Dst.g - (Dst.g >> 2) + (Src->g >> 2);
+    Dst.b = Dst.b - (Dst.b >> 2) + (Src->b >> 2);
+
+    return Dst;
+}
+
+static inline FVecRgb vecAlpha50(FVecRgb Dst, const FVecRgb* Src)
+{
+    Dst.r = (Dst.r + Src->r) >> 1;
+    Dst.g = (Dst.g + Src->g) >> 1;
+    Dst.b = (Dst.b + Src->b) >> 1;
+
+    return Dst;
+}
+
+static inline FVecRgb vecAlpha75(FVecRgb Dst, const FVecRgb* Src)
+{
+    Dst.r = (Dst.r >> 2) + Src->r - (Src->r >> 2);
+    Dst.g = (Dst.g >> 2) + Src->g - (Src->g >> 2);
+    Dst.b = (Dst.b >> 2) + Src->b - (Src->b >> 2);
+
+    return Dst;
+}
+
+#define F__VEC_SPAN_DATA(BlendExp)                               \
+    for(int i = 0; i < F__VEC_DONE(Len); i += F__VEC_LANES) {    \
+        const FVecRgb s = vecToRgb(f_pixels_vec__load(Src + i)); \
+        const FVecRgb d = vecToRgb(f_pixels_vec__load(Dst + i)); \
+                                                                 \
+        f_pixels_vec__store(Dst + i, vecFromRgb(BlendExp));      \
+    }
+
+#define F__VEC_SPAN_FLAT(BlendExp)                               \
+    const FVecRgb s = vecToRgbSplat(Rgb);                        \
+                                                                 \
+    for(int i = 0; i < F__VEC_DONE(Len); i += F__VEC_LANES) {    \
+        const FVecRgb d = vecToRgb(f_pixels_vec__load(Dst + i)); \
+                                                                 \
+        f_pixels_vec__store(Dst + i, vecFromRgb(BlendExp));      \
+    }
+#else // !F__SPAN_SIMD
+#define F__VEC_DONE(Len) 0
+#endif // !F__SPAN_SIMD
+
+void f_platform_software_span__solidData(FColorPixel* Dst, const FColorPixel* Src, int Len)
+{
+    memcpy(Dst, Src, (size_t)Len * sizeof(FColorPixel));
+}
+
+void f_platform_software_span__solidFlat(FColorPixel* Dst, FColorPixel Pixel, int Len)
+{
+    #if F__SPAN_SIMD
+        const FVecPixels pixels = f_pixels_vec__splat(Pixel);
+
+        for(int i = 0; i < F__VEC_DONE(Len); i += F__VEC_LANES) {
+            f_pixels_vec__store(Dst + i, pixels);
+        }
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        Dst[i] = Pixel;
+    }
+}
+
+void f_platform_software_span__alphaData(FColorPixel* Dst, const FColorPixel* Src, int Len, int Alpha)
+{
+    #if F__SPAN_SIMD
+        const FVecPixels a = f_pixels_vec__splat((FColorPixel)Alpha);
+        const FVecPixels aInv =
+            f_pixels_vec__splat((FColorPixel)(256 - Alpha));
+
+        F__VEC_SPAN_DATA(vecAlpha(d, &s, a, aInv))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        const FColorRgb rgb = f_color_pixelToRgb(Src[i]);
+
+        f_color__draw_alpha(Dst + i, &rgb, Alpha);
+    }
+}
+
+void f_platform_software_span__alphaFlat(FColorPixel* Dst, const FColorRgb* Rgb, int Len, int Alpha)
+{
+    #if F__SPAN_SIMD
+        const FVecPixels a = f_pixels_vec__splat((FColorPixel)Alpha);
+        const FVecPixels aInv =
+            f_pixels_vec__splat((FColorPixel)(256 - Alpha));
+
+        F__VEC_SPAN_FLAT(vecAlpha(d, &s, a, aInv))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        f_color__draw_alpha(Dst + i, Rgb, Alpha);
+    }
+}
+
+void f_platform_software_span__alpha25Data(FColorPixel* Dst, const FColorPixel* Src, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_DATA(vecAlpha25(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        const FColorRgb rgb = f_color_pixelToRgb(Src[i]);
+
+        f_color__draw_alpha25(Dst + i, &rgb);
+    }
+}
+
+void f_platform_software_span__alpha25Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_FLAT(vecAlpha25(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        f_color__draw_alpha25(Dst + i, Rgb);
+    }
+}
+
+void f_platform_software_span__alpha50Data(FColorPixel* Dst, const FColorPixel* Src, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_DATA(vecAlpha50(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        const FColorRgb rgb = f_color_pixelToRgb(Src[i]);
+
+        f_color__draw_alpha50(Dst + i, &rgb);
+    }
+}
+
+void f_platform_software_span__alpha50Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_FLAT(vecAlpha50(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        f_color__draw_alpha50(Dst + i, Rgb);
+    }
+}
+
+void f_platform_software_span__alpha75Data(FColorPixel* Dst, const FColorPixel* Src, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_DATA(vecAlpha75(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        const FColorRgb rgb = f_color_pixelToRgb(Src[i]);
+
+        f_color__draw_alpha75(Dst + i, &rgb);
+    }
+}
+
+void f_platform_software_span__alpha75Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len)
+{
+    #if F__SPAN_SIMD
+        F__VEC_SPAN_FLAT(vecAlpha75(d, &s))
+    #endif
+
+    for(int i = F__VEC_DONE(Len); i < Len; i++) {
+        f_color__draw_alpha75(Dst + i, Rgb);
+    }
+}
+
+void f_platform_software_span__zoom(FColorPixel* Dst, const FColorPixel* Src, int Len, int Zoom)
+{
+    int done = 0;
+
+    #if F__SPAN_SIMD
+        // Each source pixel is broadcast to a whole vector and stored over its
+        // run of Zoom output pixels. Short runs spill into the next run, which
+        // is written right after, so only the last few pixels of the row have
+        // to stop short of the end.
+        const int last = f_math_max(Zoom - F__VEC_LANES, 0);
+
+        done = Zoom < F__VEC_LANES
+                ? f_math_max(Len - (F__VEC_LANES - 1) / Zoom, 0) : Len;
+
+        for(int i = 0; i < done; i++, Dst += Zoom) {
+            const FVecPixels pixels = f_pixels_vec__splat(Src[i]);
+
+            for(int z = 0; z < last; z += F__VEC_LANES) {
+                f_pixels_vec__store(Dst + z, pixels);
+            }
+
+            f_pixels_vec__store(Dst + last, pixels);
+        }
+    #endif
+
+    for(int i = done; i < Len; i++) {
+        for(int z = Zoom; z--; ) {
+            *Dst++ = Src[i];
+        }
+    }
+}
+#endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
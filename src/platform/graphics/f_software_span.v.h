@@ -0,0 +1,40 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_PLATFORM_GRAPHICS_SOFTWARE_SPAN_V_H
+#define F_INC_PLATFORM_GRAPHICS_SOFTWARE_SPAN_V_H
+
+#include "f_software_span.p.h"
+
+#include "../../graphics/f_color.v.h"
+
+extern void f_platform_software_span__solidData(FColorPixel* Dst, const FColorPixel* Src, int Len);
+extern void f_platform_software_span__solidFlat(FColorPixel* Dst, FColorPixel Pixel, int Len);
+
+extern void f_platform_software_span__alphaData(FColorPixel* Dst, const FColorPixel* Src, int Len, int Alpha);
+extern void f_platform_software_span__alphaFlat(FColorPixel* Dst, const FColorRgb* Rgb, int Len, int Alpha);
+
+extern void f_platform_software_span__alpha25Data(FColorPixel* Dst, const FColorPixel* Src, int Len);
+extern void f_platform_software_span__alpha25Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len);
+extern void f_platform_software_span__alpha50Data(FColorPixel* Dst, const FColorPixel* Src, int Len);
+extern void f_platform_software_span__alpha50Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len);
+extern void f_platform_software_span__alpha75Data(FColorPixel* Dst, const FColorPixel* Src, int Len);
+extern void f_platform_software_span__alpha75Flat(FColorPixel* Dst, const FColorRgb* Rgb, int Len);
+
+extern void f_platform_software_span__zoom(FColorPixel* Dst, const FColorPixel* Src, int Len, int Zoom);
+
+#endif // F_INC_PLATFORM_GRAPHICS_SOFTWARE_SPAN_V_H
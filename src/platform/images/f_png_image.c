@@ -35,30 +35,95 @@ static void readFunction(png_structp Png, png_bytep Data, png_size_t Length)
     stream->offset += Length;
 }
 
-static FPixels* pngToPixels(png_structp Png, png_infop Info)
+#define PNG_SIG 8
+
+// Libpng delivers every row as 8-bit RGBX or RGBA, so the compiler can
+// vectorize this as a straight run of loads, shifts and stores
+static void rowToPixels(FColorPixel* Buffer, const png_byte* Row, png_uint_32 Width)
+{
+    for(png_uint_32 x = 0; x < Width; x++) {
+        Buffer[x] = f_color_pixelFromRgb3(Row[x * 4 + 0],
+                                          Row[x * 4 + 1],
+                                          Row[x * 4 + 2]);
+    }
+}
+
+static FPixels* pngRead(png_structp Png, png_infop Info, const char* Path)
 {
-    png_uint_32 w = png_get_image_width(Png, Info);
-    png_uint_32 h = png_get_image_height(Png, Info);
-    unsigned numChannels = png_get_channels(Png, Info);
-    png_bytepp rows = png_get_rows(Png, Info);
+    FPixels* volatile pixels = NULL;
+    png_bytep volatile rows = NULL;
+
+    if(setjmp(png_jmpbuf(Png))) {
+        f_pixels__free(pixels);
+        f_mem_free(rows);
+
+        f_out__error("pngRead(%s) failed", Path);
+
+        return NULL;
+    }
+
+    png_read_info(Png, Info);
+
+    const int type = png_get_color_type(Png, Info);
+
+    if(type != PNG_COLOR_TYPE_RGB
+        && type != PNG_COLOR_TYPE_RGBA
+        && type != PNG_COLOR_TYPE_PALETTE) {
+
+        f_out__error("png_get_color_type(%s): Not an RGB or RGBA PNG", Path);
+
+        return NULL;
+    }
+
+    png_set_expand(Png);
+    png_set_strip_16(Png);
+    png_set_filler(Png, 0xff, PNG_FILLER_AFTER);
+
+    const int passes = png_set_interlace_handling(Png);
+
+    png_read_update_info(Png, Info);
+
+    const png_uint_32 w = png_get_image_width(Png, Info);
+    const png_uint_32 h = png_get_image_height(Png, Info);
+    const size_t rowBytes = png_get_rowbytes(Png, Info);
+
+    pixels = f_pixels__new((int)w, (int)h, 1, F_PIXELS__ALLOC);
 
-    FPixels* pixels = f_pixels__new((int)w, (int)h, 1, F_PIXELS__ALLOC);
     FColorPixel* buffer = pixels->u.buffer;
 
-    for(png_uint_32 y = h; y--; rows++) {
-        for(png_uint_32 x = w, chOffset = 0; x--; chOffset += numChannels) {
-            *buffer++ = f_color_pixelFromRgb3(rows[0][chOffset + 0],
-                                              rows[0][chOffset + 1],
-                                              rows[0][chOffset + 2]);
+    if(passes > 1) {
+        // Interlaced passes revisit every row, so keep the whole image
+        rows = f_mem_malloc(rowBytes * h);
+
+        for(int p = passes; p--; ) {
+            for(png_uint_32 y = 0; y < h; y++) {
+                png_read_row(Png, rows + y * rowBytes, NULL);
+            }
+        }
+
+        for(png_uint_32 y = 0; y < h; y++, buffer += w) {
+            rowToPixels(buffer, rows + y * rowBytes, w);
+        }
+    } else {
+        // Decode and convert one row at a time
+        rows = f_mem_malloc(rowBytes);
+
+        for(png_uint_32 y = h; y--; buffer += w) {
+            png_read_row(Png, rows, NULL);
+            rowToPixels(buffer, rows, w);
         }
     }
 
+    png_read_end(Png, NULL);
+
+    f_mem_free(rows);
+
     return pixels;
 }
 
 static FPixels* f_png__readFile(const char* Path)
 {
-    FPixels* volatile pixels = NULL;
+    FPixels* pixels = NULL;
     png_structp png = NULL;
     png_infop info = NULL;
     FFile* f = f_file_new(Path, F_FILE_READ | F_FILE_BINARY);
@@ -69,7 +134,6 @@ static FPixels* f_png__readFile(const char* Path)
         goto cleanUp;
     }
 
-    #define PNG_SIG 8
     png_byte sig[PNG_SIG];
 
     f_file_read(f, sig, PNG_SIG);
@@ -96,30 +160,10 @@ static FPixels* f_png__readFile(const char* Path)
         goto cleanUp;
     }
 
-    if(setjmp(png_jmpbuf(png))) {
-        if(pixels != NULL) {
-            f_pixels__free(pixels);
-            pixels = NULL;
-        }
-
-        f_out__error("f_png__readFile(%s) failed", Path);
-
-        goto cleanUp;
-    }
-
     png_init_io(png, (FILE*)(f->f.platform));
     png_set_sig_bytes(png, PNG_SIG);
-    png_read_png(png, info, PNG_TRANSFORM_EXPAND, NULL);
 
-    int type = png_get_color_type(png, info);
-
-    if(type != PNG_COLOR_TYPE_RGB && type != PNG_COLOR_TYPE_RGBA) {
-        f_out__error("png_get_color_type(%s): Not an RGB or RGBA PNG", Path);
-
-        goto cleanUp;
-    }
-
-    pixels = pngToPixels(png, info);
+    pixels = pngRead(png, info, Path);
 
 cleanUp:
     if(png != NULL) {
@@ -131,20 +175,19 @@ cleanUp:
     return pixels;
 }
 
-static FPixels* f_png__readMemory(const uint8_t* Data)
+static FPixels* f_png__readMemory(const char* Path, const uint8_t* Data)
 {
-    FPixels* volatile pixels = NULL;
+    FPixels* pixels = NULL;
     png_structp png = NULL;
     png_infop info = NULL;
     FByteStream stream = {Data, 0};
 
-    #define PNG_SIG 8
     png_byte sig[PNG_SIG];
 
     memcpy(sig, Data, PNG_SIG);
 
     if(png_sig_cmp(sig, 0, PNG_SIG) != 0) {
-        f_out__error("png_sig_cmp failed");
+        f_out__error("png_sig_cmp(%s) failed", Path);
 
         goto cleanUp;
     }
@@ -152,7 +195,7 @@ static FPixels* f_png__readMemory(const uint8_t* Data)
     png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 
     if(png == NULL) {
-        f_out__error("png_create_read_struct failed");
+        f_out__error("png_create_read_struct(%s) failed", Path);
 
         goto cleanUp;
     }
@@ -160,34 +203,14 @@ static FPixels* f_png__readMemory(const uint8_t* Data)
     info = png_create_info_struct(png);
 
     if(info == NULL) {
-        f_out__error("png_create_info_struct failed");
-
-        goto cleanUp;
-    }
-
-    if(setjmp(png_jmpbuf(png))) {
-        if(pixels != NULL) {
-            f_pixels__free(pixels);
-            pixels = NULL;
-        }
-
-        f_out__error("f_png__readMemory failed");
+        f_out__error("png_create_info_struct(%s) failed", Path);
 
         goto cleanUp;
     }
 
     png_set_read_fn(png, &stream, readFunction);
-    png_read_png(png, info, PNG_TRANSFORM_EXPAND, NULL);
-
-    const int type = png_get_color_type(png, info);
-
-    if(type != PNG_COLOR_TYPE_RGB && type != PNG_COLOR_TYPE_RGBA) {
-        f_out__error("png_get_color_type: Not an RGB or RGBA PNG");
-
-        goto cleanUp;
-    }
 
-    pixels = pngToPixels(png, info);
+    pixels = pngRead(png, info, Path);
 
 cleanUp:
     if (png != NULL) {
@@ -204,7 +227,7 @@ FPixels* f_platform_api_png__imageRead(const char* Path)
     if(f_path_exists(Path, F_PATH_FILE | F_PATH_REAL)) {
         pixels = f_png__readFile(Path);
     } else if(f_path_exists(Path, F_PATH_FILE | F_PATH_EMBEDDED)) {
-        pixels = f_png__readMemory(f_embed__fileGet(Path)->buffer);
+        pixels = f_png__readMemory(Path, f_embed__fileGet(Path)->buffer);
     }
 
     return pixels;
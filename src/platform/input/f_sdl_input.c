@@ -1067,6 +1067,14 @@ void f_platform_api_sdl__inputPoll(void)
             } break;
 #endif
 
+#if F_CONFIG_LIB_SDL == 2 && F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
+            case SDL_RENDER_TARGETS_RESET:
+            case SDL_RENDER_DEVICE_RESET: {
+                // Screen texture contents may be gone, upload all of it
+                f_screen__damageAddAll();
+            } break;
+#endif
+
             case SDL_MOUSEMOTION: {
                 g_mouse.coords.x = event.motion.x;
                 g_mouse.coords.y = event.motion.y;
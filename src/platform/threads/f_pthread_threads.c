@@ -0,0 +1,231 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "f_pthread_threads.v.h"
+#include <faur.v.h>
+
+#if F_CONFIG_LIB_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+
+#define F__WORKERS_MAX 31
+
+struct FPthreadMutex {
+    pthread_mutex_t mutex;
+};
+
+struct FPthreadTls {
+    pthread_key_t key;
+};
+
+static pthread_t g_workers[F__WORKERS_MAX];
+static unsigned g_workersNum;
+
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_condWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_condDone = PTHREAD_COND_INITIALIZER;
+
+static struct {
+    FCallWork* function;
+    void* context;
+    unsigned next; // next item index to hand out
+    unsigned num; // total number of items in this job
+    unsigned pending; // items not finished yet
+    unsigned generation; // bumped for every new job
+    bool quit;
+} g_job;
+
+// Call with g_mutex locked, returns with it locked
+static void jobItemsRun(void)
+{
+    while(g_job.next < g_job.num) {
+        unsigned index = g_job.next++;
+
+        pthread_mutex_unlock(&g_mutex);
+        g_job.function(g_job.context, index);
+        pthread_mutex_lock(&g_mutex);
+
+        if(--g_job.pending == 0) {
+            pthread_cond_signal(&g_condDone);
+        }
+    }
+}
+
+static void* workerMain(void* Context)
+{
+    F_UNUSED(Context);
+
+    unsigned generation = 0;
+
+    pthread_mutex_lock(&g_mutex);
+
+    while(true) {
+        while(!g_job.quit && g_job.generation == generation) {
+            pthread_cond_wait(&g_condWork, &g_mutex);
+        }
+
+        if(g_job.quit) {
+            break;
+        }
+
+        generation = g_job.generation;
+        jobItemsRun();
+    }
+
+    pthread_mutex_unlock(&g_mutex);
+
+    return NULL;
+}
+
+void f_platform_pthread__init(void)
+{
+    long cpus = F_CONFIG_LIB_PTHREAD_WORKERS;
+
+    if(cpus <= 0) {
+        // The calling thread also works, so leave it one of the CPUs
+        cpus = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    }
+
+    unsigned num = (unsigned)f_math_clamp((int)cpus, 0, F__WORKERS_MAX);
+
+    for(unsigned w = 0; w < num; w++) {
+        if(pthread_create(&g_workers[w], NULL, workerMain, NULL) != 0) {
+            f_out__error("pthread_create failed");
+            break;
+        }
+
+        g_workersNum++;
+    }
+
+    f_out__info("Using %u worker threads", g_workersNum);
+}
+
+void f_platform_pthread__uninit(void)
+{
+    pthread_mutex_lock(&g_mutex);
+    g_job.quit = true;
+    pthread_cond_broadcast(&g_condWork);
+    pthread_mutex_unlock(&g_mutex);
+
+    for(unsigned w = g_workersNum; w--; ) {
+        pthread_join(g_workers[w], NULL);
+    }
+
+    g_workersNum = 0;
+}
+
+void f_platform_api_pthread__workRun(FCallWork* Function, void* Context, unsigned Num)
+{
+    if(Num == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_mutex);
+
+    g_job.function = Function;
+    g_job.context = Context;
+    g_job.next = 0;
+    g_job.num = Num;
+    g_job.pending = Num;
+    g_job.generation++;
+
+    if(Num > 1) {
+        pthread_cond_broadcast(&g_condWork);
+    }
+
+    // The calling thread takes items too, then waits for the stragglers
+    jobItemsRun();
+
+    while(g_job.pending > 0) {
+        pthread_cond_wait(&g_condDone, &g_mutex);
+    }
+
+    pthread_mutex_unlock(&g_mutex);
+}
+
+unsigned f_platform_api_pthread__workThreadsGet(void)
+{
+    return g_workersNum + 1;
+}
+
+FPthreadMutex* f_platform_pthread__mutexNew(void)
+{
+    FPthreadMutex* m = f_mem_malloc(sizeof(FPthreadMutex));
+
+    if(pthread_mutex_init(&m->mutex, NULL) != 0) {
+        F__FATAL("pthread_mutex_init failed");
+    }
+
+    return m;
+}
+
+void f_platform_pthread__mutexFree(FPthreadMutex* Mutex)
+{
+    if(Mutex == NULL) {
+        return;
+    }
+
+    pthread_mutex_destroy(&Mutex->mutex);
+
+    f_mem_free(Mutex);
+}
+
+void f_platform_pthread__mutexLock(FPthreadMutex* Mutex)
+{
+    pthread_mutex_lock(&Mutex->mutex);
+}
+
+void f_platform_pthread__mutexUnlock(FPthreadMutex* Mutex)
+{
+    pthread_mutex_unlock(&Mutex->mutex);
+}
+
+FPthreadTls* f_platform_pthread__tlsNew(FCallFree* Destructor)
+{
+    FPthreadTls* t = f_mem_malloc(sizeof(FPthreadTls));
+
+    if(pthread_key_create(&t->key, Destructor) != 0) {
+        F__FATAL("pthread_key_create failed");
+    }
+
+    return t;
+}
+
+void f_platform_pthread__tlsFree(FPthreadTls* Tls)
+{
+    if(Tls == NULL) {
+        return;
+    }
+
+    // Threads that still hold values do not get the destructor called
+    pthread_key_delete(Tls->key);
+
+    f_mem_free(Tls);
+}
+
+void* f_platform_pthread__tlsGet(const FPthreadTls* Tls)
+{
+    return pthread_getspecific(Tls->key);
+}
+
+void f_platform_pthread__tlsSet(FPthreadTls* Tls, void* Value)
+{
+    if(pthread_setspecific(Tls->key, Value) != 0) {
+        F__FATAL("pthread_setspecific failed");
+    }
+}
+#endif // F_CONFIG_LIB_PTHREAD
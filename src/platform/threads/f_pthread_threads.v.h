@@ -0,0 +1,44 @@
+/*
+    Copyright 2026 Alex Margarit <alex@alxm.org>
+    This file is part of Faur, a C video game framework.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License version 3,
+    as published by the Free Software Foundation.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef F_INC_PLATFORM_THREADS_PTHREAD_THREADS_V_H
+#define F_INC_PLATFORM_THREADS_PTHREAD_THREADS_V_H
+
+#include "f_pthread_threads.p.h"
+
+typedef struct FPthreadMutex FPthreadMutex;
+typedef struct FPthreadTls FPthreadTls;
+
+#include "../f_platform.v.h"
+
+extern void f_platform_pthread__init(void);
+extern void f_platform_pthread__uninit(void);
+
+extern FPthreadMutex* f_platform_pthread__mutexNew(void);
+extern void f_platform_pthread__mutexFree(FPthreadMutex* Mutex);
+extern void f_platform_pthread__mutexLock(FPthreadMutex* Mutex);
+extern void f_platform_pthread__mutexUnlock(FPthreadMutex* Mutex);
+
+extern FPthreadTls* f_platform_pthread__tlsNew(FCallFree* Destructor);
+extern void f_platform_pthread__tlsFree(FPthreadTls* Tls);
+extern void* f_platform_pthread__tlsGet(const FPthreadTls* Tls);
+extern void f_platform_pthread__tlsSet(FPthreadTls* Tls, void* Value);
+
+extern FCallApi_WorkRun f_platform_api_pthread__workRun;
+extern FCallApi_WorkThreadsGet f_platform_api_pthread__workThreadsGet;
+
+#endif // F_INC_PLATFORM_THREADS_PTHREAD_THREADS_V_H
@@ -69,6 +69,7 @@ static FPixels g_lights = {
     F__NEOPIXELS_W * F__NEOPIXELS_H * sizeof(FColorPixel),
     0,
     {g_buffer},
+    NULL,
 };
 #endif // !F_CONFIG_SYSTEM_GAMEBUINO
 
@@ -18,6 +18,9 @@
 #include "f_sdl_video.v.h"
 #include <faur.v.h>
 
+#include "../graphics/f_sdl_queue.v.h"
+#include "../graphics/f_software_span.v.h"
+
 #if F_CONFIG_LIB_SDL
 #if F_CONFIG_LIB_SDL == 1
     #include <SDL/SDL.h>
@@ -120,6 +123,9 @@ static bool sdl1ScreenSet(int Width, int Height, uint32_t Flags)
 
     SDL_SetClipRect(g_sdlScreen, NULL);
 
+    // New surface has none of the old contents
+    f_screen__damageAddAll();
+
     return true;
 }
 #endif
@@ -378,6 +384,11 @@ void f_platform_api_sdl__screenClear(void)
 #elif F_CONFIG_LIB_SDL == 2
 void f_platform_api_sdl__screenClear(void)
 {
+    #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2 \
+        && F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__flush();
+    #endif
+
     if(SDL_RenderClear(f__sdlRenderer) < 0) {
         f_out__error("SDL_RenderClear: %s", SDL_GetError());
     }
@@ -391,6 +402,10 @@ FPlatformTextureScreen* f_platform_api_sdl__screenTextureGet(void)
 
 void f_platform_api_sdl__screenTextureSet(FPlatformTextureScreen* Texture)
 {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__flush();
+    #endif
+
     if(SDL_SetRenderTarget(f__sdlRenderer, Texture) < 0) {
         F__FATAL("SDL_SetRenderTarget: %s", SDL_GetError());
     }
@@ -398,6 +413,10 @@ void f_platform_api_sdl__screenTextureSet(FPlatformTextureScreen* Texture)
 
 void f_platform_api_sdl__screenTextureSync(void)
 {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__flush();
+    #endif
+
     // Unreliable on texture targets
     if(SDL_RenderReadPixels(
         f__sdlRenderer,
@@ -412,6 +431,10 @@ void f_platform_api_sdl__screenTextureSync(void)
 
 void f_platform_api_sdl__screenToTexture(FPlatformTextureScreen* Texture, unsigned Frame)
 {
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        f_platform_sdl_queue__flush();
+    #endif
+
     if(SDL_SetRenderTarget(f__sdlRenderer, Texture) < 0) {
         F__FATAL("SDL_SetRenderTarget: %s", SDL_GetError());
     }
@@ -445,6 +468,18 @@ void f_platform_api_sdl__screenClipSet(void)
         f__screen.clipSize.y
     };
 
+    #if F_CONFIG_SCREEN_RENDER_QUEUE
+        // Queued draws were clipped to the previous area
+        static SDL_Rect lastArea;
+
+        if(area.x != lastArea.x || area.y != lastArea.y
+            || area.w != lastArea.w || area.h != lastArea.h) {
+
+            f_platform_sdl_queue__flush();
+            lastArea = area;
+        }
+    #endif
+
     if(SDL_RenderSetClipRect(f__sdlRenderer, &area) < 0) {
         f_out__error("SDL_RenderSetClipRect: %s", SDL_GetError());
     }
@@ -452,6 +487,45 @@ void f_platform_api_sdl__screenClipSet(void)
 #endif // F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
 #endif // F_CONFIG_LIB_SDL == 2
 
+#if F_CONFIG_LIB_SDL == 1 && F__ALLOCATE_LOGICAL_BUFFER
+// Each thread gets at least this many source rows to scale
+#define F__ZOOM_PART_ROWS 16
+
+typedef struct {
+    FColorPixel* dst;
+    const FColorPixel* src;
+    FVecInt size;
+    int dstRowLen;
+    unsigned parts;
+} FZoomJob;
+
+static void zoomPart(void* Context, unsigned Index)
+{
+    const FZoomJob* job = Context;
+    int yStart = (int)((unsigned)job->size.y * Index / job->parts);
+    int yEnd = (int)((unsigned)job->size.y * (Index + 1) / job->parts);
+
+    FColorPixel* dst = job->dst + yStart * g_zoom * job->dstRowLen;
+    const FColorPixel* src = job->src + yStart * g_pixels.size.x;
+    size_t rowSize = (size_t)(job->size.x * g_zoom) * sizeof(FColorPixel);
+
+    for(int y = yStart; y < yEnd; y++) {
+        FColorPixel* firstLine = dst;
+
+        f_platform_software_span__zoom(dst, src, job->size.x, g_zoom);
+
+        dst += job->dstRowLen;
+
+        for(int z = g_zoom - 1; z--; ) {
+            memcpy(dst, firstLine, rowSize);
+            dst += job->dstRowLen;
+        }
+
+        src += g_pixels.size.x;
+    }
+}
+#endif
+
 void f_platform_api_sdl__screenShow(void)
 {
     #if F_CONFIG_LIB_SDL == 1
@@ -497,51 +571,68 @@ void f_platform_api_sdl__screenShow(void)
                 }
             }
 
+            const FScreenRect* rects;
+            unsigned numRects = f_screen__damageGet(&rects);
+            int dstRowLen = g_sdlScreen->pitch / (int)sizeof(FColorPixel);
+
             if(g_zoom <= 1) {
-                if(g_pixels.size.x * (int)sizeof(FColorPixel)
-                    == g_sdlScreen->pitch) {
-
-                    memcpy(g_sdlScreen->pixels,
-                           g_pixels.u.buffer,
-                           g_pixels.bufferSize);
-                } else {
-                    uint8_t* dst = g_sdlScreen->pixels;
-                    const FColorPixel* src = g_pixels.u.buffer;
-                    size_t rowSize =
-                        (size_t)g_sdlScreen->w * sizeof(FColorPixel);
-
-                    for(int y = g_sdlScreen->h; y--; ) {
-                        memcpy(dst, src, rowSize);
-
-                        dst += g_sdlScreen->pitch;
-                        src += g_sdlScreen->w;
+                for(unsigned r = 0; r < numRects; r++) {
+                    FVecInt start = rects[r].start;
+                    FVecInt size = {rects[r].end.x - start.x,
+                                    rects[r].end.y - start.y};
+                    FColorPixel* dst = (FColorPixel*)g_sdlScreen->pixels
+                                        + start.y * dstRowLen + start.x;
+                    const FColorPixel* src =
+                        f_pixels__bufferGetFrom(&g_pixels, 0, start.x, start.y);
+
+                    if(size.x == g_pixels.size.x
+                        && dstRowLen == g_pixels.size.x) {
+
+                        memcpy(dst,
+                               src,
+                               (size_t)(size.x * size.y)
+                                * sizeof(FColorPixel));
+                    } else {
+                        size_t rowSize = (size_t)size.x * sizeof(FColorPixel);
+
+                        for(int y = size.y; y--; ) {
+                            memcpy(dst, src, rowSize);
+
+                            dst += dstRowLen;
+                            src += g_pixels.size.x;
+                        }
                     }
                 }
             } else {
-                FColorPixel* dst = g_sdlScreen->pixels;
-                const FColorPixel* src = g_pixels.u.buffer;
-                int dstRowLen = g_sdlScreen->pitch / (int)sizeof(FColorPixel);
-
-                dst += (g_sdlScreen->h - (g_zoom * g_size.y))
-                        * dstRowLen / 2
-                        + (g_sdlScreen->w - (g_zoom * g_size.x)) / 2;
-
-                for(int y = g_pixels.size.y; y--; ) {
-                    FColorPixel* firstLine = dst;
-
-                    for(int x = g_pixels.size.x; x--; ) {
-                        for(int z = g_zoom; z--; ) {
-                            *dst++ = *src;
-                        }
-
-                        src++;
-                    }
-
-                    dst = firstLine + dstRowLen;
-
-                    for(int z = g_zoom - 1; z--; ) {
-                        memcpy(dst, firstLine, (size_t)g_sdlScreen->pitch);
-                        dst += dstRowLen;
+                FColorPixel* origin = (FColorPixel*)g_sdlScreen->pixels
+                    + (g_sdlScreen->h - (g_zoom * g_size.y)) * dstRowLen / 2
+                    + (g_sdlScreen->w - (g_zoom * g_size.x)) / 2;
+
+                unsigned threads = f_platform_api__workThreadsGet();
+
+                for(unsigned r = 0; r < numRects; r++) {
+                    FVecInt start = rects[r].start;
+                    FZoomJob job = {
+                        .dst = origin
+                                + start.y * g_zoom * dstRowLen
+                                + start.x * g_zoom,
+                        .src = f_pixels__bufferGetFrom(
+                                &g_pixels, 0, start.x, start.y),
+                        .size = {rects[r].end.x - start.x,
+                                 rects[r].end.y - start.y},
+                        .dstRowLen = dstRowLen,
+                    };
+
+                    // Not worth waking the workers up for a few rows
+                    job.parts = f_math_minu(
+                                    (unsigned)job.size.y / F__ZOOM_PART_ROWS,
+                                    threads);
+
+                    if(job.parts > 1) {
+                        f_platform_api__workRun(zoomPart, &job, job.parts);
+                    } else {
+                        job.parts = 1;
+                        zoomPart(&job, 0);
                     }
                 }
             }
@@ -571,6 +662,10 @@ void f_platform_api_sdl__screenShow(void)
         #endif
     #elif F_CONFIG_LIB_SDL == 2
         #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SDL2
+            #if F_CONFIG_SCREEN_RENDER_QUEUE
+                f_platform_sdl_queue__flush();
+            #endif
+
             if(SDL_SetRenderTarget(f__sdlRenderer, NULL) < 0) {
                 F__FATAL("SDL_SetRenderTarget: %s", SDL_GetError());
             }
@@ -594,13 +689,25 @@ void f_platform_api_sdl__screenShow(void)
         }
 
         #if F_CONFIG_SCREEN_RENDER == F_SCREEN_RENDER_SOFTWARE
-            if(SDL_UpdateTexture(
-                g_sdlTexture,
-                NULL,
-                g_pixels.u.buffer,
-                g_pixels.size.x * (int)sizeof(FColorPixel)) < 0) {
-
-                F__FATAL("SDL_UpdateTexture: %s", SDL_GetError());
+            const FScreenRect* rects;
+            unsigned numRects = f_screen__damageGet(&rects);
+
+            // The texture keeps last frame's pixels, only upload changes
+            for(unsigned r = 0; r < numRects; r++) {
+                SDL_Rect area = {rects[r].start.x,
+                                 rects[r].start.y,
+                                 rects[r].end.x - rects[r].start.x,
+                                 rects[r].end.y - rects[r].start.y};
+
+                if(SDL_UpdateTexture(
+                    g_sdlTexture,
+                    &area,
+                    f_pixels__bufferGetFrom(
+                        &g_pixels, 0, area.x, area.y),
+                    g_pixels.size.x * (int)sizeof(FColorPixel)) < 0) {
+
+                    F__FATAL("SDL_UpdateTexture: %s", SDL_GetError());
+                }
             }
 
             if(SDL_RenderCopy(f__sdlRenderer, g_sdlTexture, NULL, NULL) < 0) {